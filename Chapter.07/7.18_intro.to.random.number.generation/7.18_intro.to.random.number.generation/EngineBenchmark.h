@@ -0,0 +1,292 @@
+//
+//  EngineBenchmark.h
+//  7.18_intro.to.random.number.generation
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef EngineBenchmark_h
+#define EngineBenchmark_h
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/// Measures how fast a random number engine is and how random its numbers look
+/// - speed: numbers per nanosecond and random bits per nanosecond (engines return 15 to 64 bits)
+/// - chi-square: numbers are sorted into 256 equal buckets, every bucket should get about the same
+///   share
+/// - serial correlation: a number shouldn't tell anything about the next one
+/// - birthday spacings (Marsaglia): random "birthdays" in a year of 2^32 days, the spacings between
+///   sorted birthdays should repeat about as often as the Poisson distribution predicts; weak
+///   engines, especially ones with few or poor low bits, repeat spacings far too often
+/// every test reports a z-score, how many standard deviations the result is from what a perfect
+/// generator would give on average: |z| < 3 passes, larger values are suspicious
+namespace EngineBenchmark
+{
+    struct Options
+    {
+        std::uint64_t speed_count{ 100'000'000 };       /// numbers generated for the speed measurement
+        std::uint64_t test_count{ 10'000'000 };         /// numbers for chi-square and serial correlation
+        int birthday_rounds{ 200 };                     /// each round draws 4096 birthdays
+    };
+
+    struct Result
+    {
+        std::string name{};
+        int bits{};                     /// random bits per number
+        double numbers_per_ns{};
+        double chi_square_z{};
+        double serial_correlation{};
+        double serial_z{};
+        double birthday_z{};
+
+        bool passed() const
+        {
+            return std::fabs(chi_square_z) < 3.0 && std::fabs(serial_z) < 3.0 && std::fabs(birthday_z) < 3.0;
+        }
+    };
+
+    namespace detail
+    {
+        /// number of full random bits per engine output: std::minstd_rand returns 1 to 2^31 - 2, which
+        /// is a bit less than 31 bits, so it counts as 30
+        template <class Engine>
+        constexpr int bits_per_number()
+        {
+            const std::uint64_t range{ static_cast<std::uint64_t>(Engine::max() - Engine::min()) };
+            if (range == ~std::uint64_t{ 0 })
+                return 64;
+
+            int bits{ 0 };
+            while (bits < 63 && (std::uint64_t{ 1 } << (bits + 1)) <= range + 1)
+                ++bits;
+
+            return bits;
+        }
+
+        /// the next output scaled to [0, 2^bits), engines whose range isn't a power of two are
+        /// stretched or squeezed to fit
+        template <class Engine>
+        std::uint64_t next_number(Engine& engine)
+        {
+            constexpr int bits{ bits_per_number<Engine>() };
+            constexpr std::uint64_t range{ static_cast<std::uint64_t>(Engine::max() - Engine::min()) };
+            const std::uint64_t value{ static_cast<std::uint64_t>(engine() - Engine::min()) };
+
+            /// range + 1 is a power of two (or 2^64, which wraps to 0)
+            if constexpr (((range + 1) & range) == 0)
+                return value;
+            /// value < 2^(bits + 1), so value * 2^bits fits into 64 bits (minstd_rand, knuth_b)
+            else if constexpr (2 * bits + 1 <= 64)
+                return (value << bits) / (range + 1);
+            else
+            {
+                /// value * 2^bits / (range + 1) one bit at a time, the remainder stays below range + 1,
+                /// the bit shifted out of it is kept in carry
+                std::uint64_t quotient{ 0 };
+                std::uint64_t remainder{ value };
+
+                for (int bit{ 0 }; bit < bits; ++bit)
+                {
+                    const bool carry{ (remainder >> 63) != 0 };
+                    remainder <<= 1;
+                    quotient <<= 1;
+
+                    if (carry || remainder >= range + 1)
+                    {
+                        remainder -= range + 1;
+                        quotient |= 1;
+                    }
+                }
+
+                return quotient;
+            }
+        }
+
+        /// a number in [0, 1) from the next output
+        template <class Engine>
+        double uniform(Engine& engine)
+        {
+            constexpr int bits{ bits_per_number<Engine>() };
+            const std::uint64_t value{ next_number(engine) };
+
+            /// a double only holds 53 bits
+            if constexpr (bits > 53)
+                return static_cast<double>(value >> (bits - 53)) * 0x1.0p-53;
+            else
+                return static_cast<double>(value) / static_cast<double>(std::uint64_t{ 1 } << bits);
+        }
+
+        /// count random bits, put together from as many outputs as needed
+        template <class Engine>
+        std::uint64_t next_bits(Engine& engine, int count)
+        {
+            constexpr int bits{ bits_per_number<Engine>() };
+            std::uint64_t result{ 0 };
+            int have{ 0 };
+
+            while (have < count)
+            {
+                const std::uint64_t value{ next_number(engine) };
+                const int take{ std::min(bits, count - have) };
+
+                /// the high bits of an output are usually the better ones
+                result = (take == 64 ? 0 : result << take) | (value >> (bits - take));
+                have += take;
+            }
+
+            return result;
+        }
+
+        template <class Engine>
+        double measure_speed(Engine& engine, std::uint64_t count)
+        {
+            /// every number goes into the sum, so the compiler can't skip generating them
+            std::uint64_t sum{ 0 };
+
+            const auto start{ std::chrono::steady_clock::now() };
+            for (std::uint64_t i{ 0 }; i < count; ++i)
+                sum += static_cast<std::uint64_t>(engine());
+            const auto stop{ std::chrono::steady_clock::now() };
+
+            volatile std::uint64_t sink{ sum };
+            static_cast<void>(sink);
+
+            const double nanoseconds{ static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()) };
+            return static_cast<double>(count) / std::max(nanoseconds, 1.0);
+        }
+
+        template <class Engine>
+        void distribution_tests(Engine& engine, std::uint64_t count, Result& result)
+        {
+            constexpr int buckets{ 256 };
+            std::vector<std::uint64_t> counts(buckets, 0);
+
+            /// serial correlation of consecutive pairs, from the sums of x, x^2 and x * next
+            double previous{ uniform(engine) };
+            const double first{ previous };
+            double sum{ 0.0 };
+            double sum_squares{ 0.0 };
+            double sum_products{ 0.0 };
+
+            for (std::uint64_t i{ 0 }; i < count; ++i)
+            {
+                const double value{ i + 1 < count ? uniform(engine) : first };   /// the last pair wraps around
+
+                ++counts[static_cast<std::size_t>(previous * buckets)];
+                sum += previous;
+                sum_squares += previous * previous;
+                sum_products += previous * value;
+
+                previous = value;
+            }
+
+            const double expected{ static_cast<double>(count) / buckets };
+            double chi_square{ 0.0 };
+            for (std::uint64_t observed : counts)
+                chi_square += (static_cast<double>(observed) - expected) * (static_cast<double>(observed) - expected) / expected;
+
+            const double degrees{ buckets - 1.0 };
+            result.chi_square_z = (chi_square - degrees) / std::sqrt(2.0 * degrees);
+
+            const double n{ static_cast<double>(count) };
+            const double numerator{ n * sum_products - sum * sum };
+            const double denominator{ n * sum_squares - sum * sum };
+            result.serial_correlation = denominator != 0.0 ? numerator / denominator : 1.0;
+            result.serial_z = result.serial_correlation * std::sqrt(n);
+        }
+
+        template <class Engine>
+        double birthday_spacings(Engine& engine, int rounds)
+        {
+            constexpr int birthdays{ 4096 };
+            constexpr int day_bits{ 32 };
+
+            /// expected number of repeated spacings per round: birthdays^3 / (4 * days) = 4
+            const double lambda{ std::pow(birthdays, 3.0) / (4.0 * std::pow(2.0, day_bits)) };
+
+            std::vector<std::uint64_t> days(birthdays);
+            std::vector<std::uint64_t> spacings(birthdays);
+            std::uint64_t repeats{ 0 };
+
+            for (int round{ 0 }; round < rounds; ++round)
+            {
+                for (std::uint64_t& day : days)
+                    day = next_bits(engine, day_bits);
+
+                std::sort(days.begin(), days.end());
+
+                spacings[0] = days[0];
+                for (int i{ 1 }; i < birthdays; ++i)
+                    spacings[i] = days[i] - days[i - 1];
+
+                std::sort(spacings.begin(), spacings.end());
+
+                for (int i{ 1 }; i < birthdays; ++i)
+                    if (spacings[i] == spacings[i - 1])
+                        ++repeats;
+            }
+
+            const double expected{ lambda * rounds };
+            return (static_cast<double>(repeats) - expected) / std::sqrt(expected);
+        }
+    }
+
+    /// runs every measurement on engine, which should be freshly seeded
+    template <class Engine>
+    Result run(const std::string& name, Engine engine, const Options& options = {})
+    {
+        Result result{};
+        result.name = name;
+        result.bits = detail::bits_per_number<Engine>();
+
+        result.numbers_per_ns = detail::measure_speed(engine, options.speed_count);
+        detail::distribution_tests(engine, options.test_count, result);
+        result.birthday_z = detail::birthday_spacings(engine, options.birthday_rounds);
+
+        return result;
+    }
+
+    inline void print_table(const std::vector<Result>& results, std::ostream& out = std::cout)
+    {
+        const std::ios_base::fmtflags flags{ out.flags() };
+        const std::streamsize precision{ out.precision() };
+
+        out << std::left << std::setw(20) << "engine" << std::right
+            << std::setw(6) << "bits"
+            << std::setw(12) << "numbers/ns"
+            << std::setw(10) << "bits/ns"
+            << std::setw(14) << "chi-square z"
+            << std::setw(13) << "serial corr"
+            << std::setw(10) << "serial z"
+            << std::setw(12) << "birthday z"
+            << std::setw(8) << "result" << '\n';
+
+        out << std::fixed;
+
+        for (const Result& result : results)
+        {
+            out << std::left << std::setw(20) << result.name << std::right
+                << std::setw(6) << result.bits
+                << std::setprecision(3) << std::setw(12) << result.numbers_per_ns
+                << std::setprecision(2) << std::setw(10) << result.numbers_per_ns * result.bits
+                << std::setw(14) << result.chi_square_z
+                << std::setprecision(5) << std::setw(13) << result.serial_correlation
+                << std::setprecision(2) << std::setw(10) << result.serial_z
+                << std::setw(12) << result.birthday_z
+                << std::setw(8) << (result.passed() ? "pass" : "FAIL") << '\n';
+        }
+
+        out.flags(flags);
+        out.precision(precision);
+    }
+}
+
+#endif /* EngineBenchmark_h */
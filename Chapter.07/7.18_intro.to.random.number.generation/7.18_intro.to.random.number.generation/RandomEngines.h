@@ -0,0 +1,141 @@
+//
+//  RandomEngines.h
+//  7.18_intro.to.random.number.generation
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef RandomEngines_h
+#define RandomEngines_h
+
+#include <cstdint>
+#include <limits>
+
+/// Random number engines to compare with the ones in <random>
+/// each one works like std::mt19937: engine() returns the next number, min() and max() give the range,
+/// so they can be used with std::uniform_int_distribution and the rest of <random>
+namespace Engines
+{
+    /// LCG16() from main.cpp as an engine object, with its state in the object instead of a static
+    /// variable, so several can run side by side
+    class LCG16
+    {
+    private:
+        unsigned int m_state{ 5323 };
+
+    public:
+        using result_type = unsigned int;
+
+        LCG16() = default;
+        explicit LCG16(unsigned int seed) : m_state{ seed } {}
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return 32767; }
+
+        result_type operator()()
+        {
+            m_state = 8253729 * m_state + 2396403;
+            return m_state % 32768;
+        }
+    };
+
+    /// SplitMix64, mostly used to turn one seed into the larger state of the other engines
+    class SplitMix64
+    {
+    private:
+        std::uint64_t m_state{};
+
+    public:
+        using result_type = std::uint64_t;
+
+        explicit SplitMix64(std::uint64_t seed = 0) : m_state{ seed } {}
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()()
+        {
+            std::uint64_t z{ m_state += 0x9E3779B97F4A7C15ull };
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+    };
+
+    /// xoshiro256** (Blackman and Vigna), 256 bits of state, 64-bit output, a few shifts and rotates
+    /// per number
+    class Xoshiro256StarStar
+    {
+    private:
+        std::uint64_t m_state[4]{};
+
+        static std::uint64_t rotate_left(std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    public:
+        using result_type = std::uint64_t;
+
+        explicit Xoshiro256StarStar(std::uint64_t seed = 1)
+        {
+            SplitMix64 mix{ seed };
+            for (std::uint64_t& word : m_state)
+                word = mix();
+        }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()()
+        {
+            const std::uint64_t result{ rotate_left(m_state[1] * 5, 7) * 9 };
+            const std::uint64_t t{ m_state[1] << 17 };
+
+            m_state[2] ^= m_state[0];
+            m_state[3] ^= m_state[1];
+            m_state[1] ^= m_state[2];
+            m_state[0] ^= m_state[3];
+            m_state[2] ^= t;
+            m_state[3] = rotate_left(m_state[3], 45);
+
+            return result;
+        }
+    };
+
+    /// PCG32 (O'Neill), a 64-bit LCG whose output is scrambled by a shift and a data dependent rotate,
+    /// 32-bit output
+    class PCG32
+    {
+    private:
+        std::uint64_t m_state{};
+        std::uint64_t m_increment{};
+
+        static constexpr std::uint64_t s_multiplier{ 6364136223846793005ull };
+
+    public:
+        using result_type = std::uint32_t;
+
+        /// stream selects one of 2^63 different sequences
+        explicit PCG32(std::uint64_t seed = 0x853C49E6748FEA9Bull, std::uint64_t stream = 0xDA3E39CB94B95BDBull)
+            : m_increment{ (stream << 1) | 1 }
+        {
+            operator()();
+            m_state += seed;
+            operator()();
+        }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()()
+        {
+            const std::uint64_t old{ m_state };
+            m_state = old * s_multiplier + m_increment;
+
+            const std::uint32_t shifted{ static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27) };
+            const int rotation{ static_cast<int>(old >> 59) };
+
+            return (shifted >> rotation) | (shifted << ((32 - rotation) & 31));
+        }
+    };
+}
+
+#endif /* RandomEngines_h */
@@ -224,6 +224,11 @@
  */
 
 #include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+#include "RandomEngines.h"
+#include "EngineBenchmark.h"
 
 /// this algorithm is stateful, because of static variable used inside
 /// simple algorithm to generate a sequence of numbers, each successive number is incremented by 1
@@ -252,8 +257,31 @@ unsigned int LCG16()
     return s_state % 32768;
 }
 
-int main()
+/// compares LCG16 with the engines from <random> and two modern ones
+void run_benchmark()
 {
+    const EngineBenchmark::Options options{};
+    std::vector<EngineBenchmark::Result> results{};
+    
+    results.push_back(EngineBenchmark::run("LCG16", Engines::LCG16{}, options));
+    results.push_back(EngineBenchmark::run("minstd_rand", std::minstd_rand{}, options));
+    results.push_back(EngineBenchmark::run("mt19937", std::mt19937{}, options));
+    results.push_back(EngineBenchmark::run("mt19937_64", std::mt19937_64{}, options));
+    results.push_back(EngineBenchmark::run("xoshiro256**", Engines::Xoshiro256StarStar{}, options));
+    results.push_back(EngineBenchmark::run("PCG32", Engines::PCG32{}, options));
+    
+    EngineBenchmark::print_table(results);
+}
+
+/// run with --benchmark to compare the engines instead of printing the sequences
+int main(int argc, char* argv[])
+{
+    if (argc > 1 && std::string_view{ argv[1] } == "--benchmark")
+    {
+        run_benchmark();
+        return 0;
+    }
+    
     std::cout << plus_one() << '\n';
     std::cout << plus_one() << '\n';
     std::cout << plus_one() << '\n';
@@ -0,0 +1,157 @@
+//
+//  CounterRandom.h
+//  7.19_generating.random.numbers.using.mersenne.twister
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef CounterRandom_h
+#define CounterRandom_h
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+/// Counter-based random numbers (Philox4x32-10, Salmon et al. 2011)
+/// a std::mt19937 has a state, every number depends on all the numbers before it, so two threads
+/// sharing one engine get different numbers depending on who comes first
+/// here the number at (seed, stream, index) is a fixed function of those three values:
+/// - every work item can have its own stream, nothing is shared between threads
+/// - jumping to any index is one computation, no need to generate the numbers before it
+/// - no seeding cost, creating a stream is just storing the seed and the stream number
+/// so a parallel simulation gives exactly the same results with 1 thread or 16
+namespace Counter
+{
+    using Block = std::array<std::uint32_t, 4>;
+    using Key = std::array<std::uint32_t, 2>;
+
+    namespace detail
+    {
+        constexpr std::uint32_t s_multiplier0{ 0xD2511F53 };
+        constexpr std::uint32_t s_multiplier1{ 0xCD9E8D57 };
+        constexpr std::uint32_t s_weyl0{ 0x9E3779B9 };
+        constexpr std::uint32_t s_weyl1{ 0xBB67AE85 };
+
+        constexpr Block round(const Block& counter, const Key& key)
+        {
+            const std::uint64_t product0{ std::uint64_t{ s_multiplier0 } * counter[0] };
+            const std::uint64_t product1{ std::uint64_t{ s_multiplier1 } * counter[2] };
+
+            return { static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+                     static_cast<std::uint32_t>(product1),
+                     static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+                     static_cast<std::uint32_t>(product0) };
+        }
+    }
+
+    /// the Philox4x32-10 bijection: 4 random 32-bit numbers for one 128-bit counter and 64-bit key
+    constexpr Block philox(Block counter, Key key)
+    {
+        for (int i{ 0 }; i < 10; ++i)
+        {
+            if (i > 0)
+            {
+                key[0] += detail::s_weyl0;
+                key[1] += detail::s_weyl1;
+            }
+
+            counter = detail::round(counter, key);
+        }
+
+        return counter;
+    }
+
+    /// the index-th 32-bit number of stream in the sequence chosen by seed
+    /// the counter is (index / 4, stream) and every call to philox gives 4 numbers
+    constexpr std::uint32_t at(std::uint64_t seed, std::uint64_t stream, std::uint64_t index)
+    {
+        const std::uint64_t block{ index / 4 };
+        const Block counter{ static_cast<std::uint32_t>(block), static_cast<std::uint32_t>(block >> 32),
+                             static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32) };
+
+        return philox(counter, { static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32) })[index % 4];
+    }
+
+    /// a number in [min, max] from 32 random bits, by multiplying instead of %
+    /// the result only depends on value, so it is the same on every compiler and standard library,
+    /// unlike std::uniform_int_distribution; the bias is at most (max - min + 1) / 2^32
+    constexpr int bounded(std::uint32_t value, int min, int max)
+    {
+        const std::uint64_t range{ static_cast<std::uint64_t>(static_cast<std::int64_t>(max) - min + 1) };
+        return static_cast<int>(static_cast<std::int64_t>(min) + static_cast<std::int64_t>((value * range) >> 32));
+    }
+
+    /// a number in [0, 1) from 32 random bits
+    constexpr double uniform(std::uint32_t value)
+    {
+        return value * 0x1.0p-32;
+    }
+
+    /// one stream as an engine like std::mt19937, so it works with the distributions in <random>:
+    ///
+    ///     Counter::Stream rng{ seed, work_item };
+    ///     std::uniform_int_distribution die{ 1, 6 };
+    ///     die(rng);
+    ///
+    /// it only keeps the current block of 4 numbers, and seek() / discard() jump anywhere in O(1)
+    class Stream
+    {
+    private:
+        Key m_key{};
+        std::uint32_t m_stream_low{};
+        std::uint32_t m_stream_high{};
+        std::uint64_t m_index{ 0 };
+        Block m_block{};
+
+        void refill()
+        {
+            const std::uint64_t block{ m_index / 4 };
+            m_block = philox({ static_cast<std::uint32_t>(block), static_cast<std::uint32_t>(block >> 32), m_stream_low, m_stream_high }, m_key);
+        }
+
+    public:
+        using result_type = std::uint32_t;
+
+        explicit Stream(std::uint64_t seed = 0, std::uint64_t stream = 0, std::uint64_t index = 0)
+            : m_key{ static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32) }
+            , m_stream_low{ static_cast<std::uint32_t>(stream) }
+            , m_stream_high{ static_cast<std::uint32_t>(stream >> 32) }
+            , m_index{ index }
+        {
+            refill();
+        }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()()
+        {
+            const result_type value{ m_block[m_index % 4] };
+
+            if (++m_index % 4 == 0)
+                refill();
+
+            return value;
+        }
+
+        /// index of the next number
+        std::uint64_t index() const { return m_index; }
+
+        /// the next number will be the index-th of the stream
+        void seek(std::uint64_t index)
+        {
+            const bool same_block{ index / 4 == m_index / 4 };
+            m_index = index;
+
+            if (!same_block)
+                refill();
+        }
+
+        void discard(std::uint64_t count) { seek(m_index + count); }
+
+        /// next number in [min, max], one number used per call, see Counter::bounded
+        int get(int min, int max) { return bounded(operator()(), min, max); }
+    };
+}
+
+#endif /* CounterRandom_h */
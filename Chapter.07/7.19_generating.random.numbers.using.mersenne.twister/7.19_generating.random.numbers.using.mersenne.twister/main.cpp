@@ -153,6 +153,10 @@
 /// chrono : gives access to the clock
 #include <chrono>
 #include <iostream>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "CounterRandom.h"
 
 /// used capital R in Random to avoid conflicts with functions named random()
 namespace Random
@@ -182,6 +186,52 @@ int get_card()
     return card(mt);
 }
 
+/// the draw-th card of deck number deck, computed directly from the counter
+/// no engine to create or seed, and the same (deck, draw) always gives the same card
+int get_card(std::uint64_t seed, std::uint64_t deck, std::uint64_t draw)
+{
+    return Counter::bounded(Counter::at(seed, deck, draw), 1, 52);
+}
+
+/// Monte Carlo estimate of pi, split into chunks of work shared by threads
+/// chunk c always uses stream c, so the estimate doesn't change with the number of threads
+double estimate_pi(std::uint64_t seed, std::uint64_t chunks, std::uint64_t samples_per_chunk, unsigned int thread_count)
+{
+    std::vector<std::uint64_t> inside(chunks, 0);
+    std::vector<std::thread> threads{};
+    
+    for (unsigned int t{ 0 }; t < thread_count; ++t)
+    {
+        threads.emplace_back([&inside, seed, chunks, samples_per_chunk, thread_count, t]() {
+            for (std::uint64_t chunk{ t }; chunk < chunks; chunk += thread_count)
+            {
+                Counter::Stream rng{ seed, chunk };
+                std::uint64_t hits{ 0 };
+                
+                for (std::uint64_t i{ 0 }; i < samples_per_chunk; ++i)
+                {
+                    const double x{ Counter::uniform(rng()) };
+                    const double y{ Counter::uniform(rng()) };
+                    
+                    if (x * x + y * y < 1.0)
+                        ++hits;
+                }
+                
+                inside[chunk] = hits;
+            }
+        });
+    }
+    
+    for (std::thread& thread : threads)
+        thread.join();
+    
+    std::uint64_t total{ 0 };
+    for (std::uint64_t hits : inside)
+        total += hits;
+    
+    return 4.0 * static_cast<double>(total) / static_cast<double>(chunks * samples_per_chunk);
+}
+
 int main()
 {
     /// -----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -292,5 +342,21 @@ int main()
             std::cout << '\n';
     }
     
+    std::cout << '\n';
+    
+    /// -----------------------------------------------------------------------------------------------------------------------------------------------------
+    /// counter-based random numbers : the value at (seed, stream, index) is computed directly
+    /// card 3 of deck 7 is always the same card, and it doesn't matter which cards were drawn before
+    std::cout << get_card(2, 7, 0) << ' ' << get_card(2, 7, 1) << ' ' << get_card(2, 7, 2) << '\n';
+    
+    /// a stream can jump ahead without generating the numbers in between
+    Counter::Stream deck{ 2, 7 };
+    deck.discard(2);
+    std::cout << deck.get(1, 52) << '\n';
+    
+    /// the same estimate with 1 and 4 threads
+    std::cout << estimate_pi(2, 64, 100'000, 1) << '\n';
+    std::cout << estimate_pi(2, 64, 100'000, 4) << '\n';
+    
     return 0;
 }
@@ -102,6 +102,14 @@
  RULE:
  use std::string or std::string_view instead of c-style strings
  
+ ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ Scanning long strings:
+ strlen() followed by a counting loop - reads the whole string twice, one char at a time
+ 
+ TextKernels.h - compares 16(SSE2) or 32(AVX2) chars at once, length_and_count() finds the
+ null terminator and counts a character in the same pass, count() and find_first_of() work
+ on a std::string_view whose length is already known
+ 
  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  */
 
@@ -109,6 +117,7 @@
 #include <iostream>
 #include <iterator>     /// for std::size
 #include <cstring>
+#include "TextKernels.h"
 
 int main()
 {
@@ -200,5 +209,9 @@ int main()
     
     std::cout << "You typed " << spaces_found << " spaces!" << '\n';
     
+    /// length and spaces in a single pass, many characters at a time
+    TextKernels::LengthAndCount scanned{ TextKernels::length_and_count(buffer, ' ') };
+    std::cout << "You typed " << scanned.count << " spaces in " << scanned.length << " characters!" << '\n';
+    
     return 0;
 }
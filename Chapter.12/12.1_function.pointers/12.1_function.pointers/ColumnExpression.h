@@ -0,0 +1,374 @@
+//
+//  ColumnExpression.h
+//  12.1_function.pointers
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef ColumnExpression_h
+#define ColumnExpression_h
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/// An arithmetic formula like "(price - cost) * quantity / 100" applied to whole columns of numbers
+///
+/// get_arithmetic_function() picks one function per operator and calls it through std::function for
+/// every pair of numbers, here the formula is parsed once and compiled into a short list of
+/// instructions (bytecode), each instruction is then run over a chunk of 256 rows in one simple loop,
+/// so the cost of deciding what to do is paid once per chunk, not once per number, and the
+/// loops are simple enough for the compiler to vectorize
+///
+/// rows that divide by zero (or overflow, for integers) are reported per row instead of stopping the
+/// whole evaluation
+template <typename T>
+class ColumnExpression
+{
+    static_assert(std::is_floating_point_v<T> || (std::is_integral_v<T> && std::is_signed_v<T> && sizeof(T) <= 4),
+                  "ColumnExpression works with floating point types and signed integers up to 32 bits");
+
+public:
+    /// per row error flags, combined with | when a row has several problems
+    enum RowError : std::uint8_t
+    {
+        no_error = 0,
+        division_by_zero = 1 << 0,
+        overflow = 1 << 1,
+    };
+
+    static constexpr std::size_t s_chunk_size{ 256 };
+
+private:
+    enum class OpCode : std::uint8_t
+    {
+        column,     /// push column m_operand
+        constant,   /// push m_constants[m_operand]
+        add,
+        subtract,
+        multiply,
+        divide,
+        negate,
+    };
+
+    struct Instruction
+    {
+        OpCode op{};
+        std::uint32_t operand{};
+    };
+
+    std::vector<Instruction> m_code{};
+    std::vector<T> m_constants{};
+    std::size_t m_column_count{};
+    std::size_t m_stack_depth{};
+
+    /// integers are computed in a wider type and checked, so overflow is reported instead of being undefined
+    using Wide = std::conditional_t<std::is_integral_v<T>, std::int64_t, T>;
+
+    /// recursive descent parser, produces the instructions in postfix order:
+    ///     expression := term (('+' | '-') term)*
+    ///     term       := factor (('*' | '/') factor)*
+    ///     factor     := number | name | '(' expression ')' | '-' factor
+    class Parser
+    {
+    private:
+        std::string_view m_text{};
+        std::size_t m_position{ 0 };
+        const std::vector<std::string_view>& m_names;
+        ColumnExpression& m_result;
+        std::string m_error{};
+        std::size_t m_depth{ 0 };
+
+        void skip_spaces()
+        {
+            while (m_position < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_position])))
+                ++m_position;
+        }
+
+        bool accept(char ch)
+        {
+            skip_spaces();
+            if (m_position < m_text.size() && m_text[m_position] == ch)
+            {
+                ++m_position;
+                return true;
+            }
+
+            return false;
+        }
+
+        void fail(std::string message)
+        {
+            if (m_error.empty())
+                m_error = std::move(message) + " at position " + std::to_string(m_position);
+        }
+
+        /// tracks how many values are on the stack, to size the scratch buffers later
+        void emit(OpCode op, std::uint32_t operand = 0)
+        {
+            m_result.m_code.push_back({ op, operand });
+
+            if (op == OpCode::column || op == OpCode::constant)
+                m_result.m_stack_depth = std::max(m_result.m_stack_depth, ++m_depth);
+            else if (op != OpCode::negate)
+                --m_depth;
+        }
+
+        void expression()
+        {
+            term();
+            while (m_error.empty())
+            {
+                if (accept('+')) { term(); emit(OpCode::add); }
+                else if (accept('-')) { term(); emit(OpCode::subtract); }
+                else break;
+            }
+        }
+
+        void term()
+        {
+            factor();
+            while (m_error.empty())
+            {
+                if (accept('*')) { factor(); emit(OpCode::multiply); }
+                else if (accept('/')) { factor(); emit(OpCode::divide); }
+                else break;
+            }
+        }
+
+        void factor()
+        {
+            skip_spaces();
+
+            if (accept('('))
+            {
+                expression();
+                if (!accept(')'))
+                    fail("expected ')'");
+            }
+            else if (accept('-'))
+            {
+                factor();
+                emit(OpCode::negate);
+            }
+            else if (m_position < m_text.size() && (std::isdigit(static_cast<unsigned char>(m_text[m_position])) || m_text[m_position] == '.'))
+                number();
+            else if (m_position < m_text.size() && (std::isalpha(static_cast<unsigned char>(m_text[m_position])) || m_text[m_position] == '_'))
+                name();
+            else
+                fail("expected a number, a column name or '('");
+        }
+
+        void number()
+        {
+            const std::string text{ m_text.substr(m_position) };
+            char* end{};
+            const double value{ std::strtod(text.c_str(), &end) };
+            const std::size_t length{ static_cast<std::size_t>(end - text.c_str()) };
+
+            if (length == 0)
+            {
+                fail("expected a number");
+                return;
+            }
+
+            if constexpr (std::is_integral_v<T>)
+            {
+                if (value > static_cast<double>(std::numeric_limits<T>::max())
+                    || value != static_cast<double>(static_cast<std::int64_t>(value)))
+                {
+                    fail("expected an integer");
+                    return;
+                }
+            }
+
+            m_position += length;
+            m_result.m_constants.push_back(static_cast<T>(value));
+            emit(OpCode::constant, static_cast<std::uint32_t>(m_result.m_constants.size() - 1));
+        }
+
+        void name()
+        {
+            const std::size_t first{ m_position };
+            while (m_position < m_text.size() && (std::isalnum(static_cast<unsigned char>(m_text[m_position])) || m_text[m_position] == '_'))
+                ++m_position;
+
+            const std::string_view identifier{ m_text.substr(first, m_position - first) };
+            const auto found{ std::find(m_names.begin(), m_names.end(), identifier) };
+
+            if (found == m_names.end())
+            {
+                fail("unknown column '" + std::string{ identifier } + "'");
+                return;
+            }
+
+            emit(OpCode::column, static_cast<std::uint32_t>(found - m_names.begin()));
+        }
+
+    public:
+        Parser(std::string_view text, const std::vector<std::string_view>& names, ColumnExpression& result)
+            : m_text{ text }, m_names{ names }, m_result{ result }
+        {
+        }
+
+        std::string parse()
+        {
+            expression();
+            skip_spaces();
+
+            if (m_error.empty() && m_position != m_text.size())
+                fail("unexpected '" + std::string{ m_text[m_position] } + "'");
+
+            return m_error;
+        }
+    };
+
+    /// the binary operations, each one runs over a whole chunk
+    /// integer results that don't fit into T are flagged and replaced by 0
+    template <class Op>
+    static void binary(const T* left, const T* right, T* out, std::uint8_t* errors, std::size_t count, Op op)
+    {
+        for (std::size_t i{ 0 }; i < count; ++i)
+        {
+            const Wide result{ op(static_cast<Wide>(left[i]), static_cast<Wide>(right[i])) };
+
+            if constexpr (std::is_integral_v<T>)
+            {
+                const bool out_of_range{ result < std::numeric_limits<T>::min() || result > std::numeric_limits<T>::max() };
+                errors[i] |= out_of_range ? overflow : no_error;
+                out[i] = out_of_range ? T{ 0 } : static_cast<T>(result);
+            }
+            else
+                out[i] = result;
+        }
+    }
+
+    static void divide(const T* left, const T* right, T* out, std::uint8_t* errors, std::size_t count)
+    {
+        for (std::size_t i{ 0 }; i < count; ++i)
+        {
+            /// divide by 1 instead of 0 so nothing traps, the row is flagged and its result is meaningless
+            const bool zero{ right[i] == T{ 0 } };
+            const Wide divisor{ zero ? Wide{ 1 } : static_cast<Wide>(right[i]) };
+            const Wide result{ static_cast<Wide>(left[i]) / divisor };
+
+            errors[i] |= zero ? division_by_zero : no_error;
+
+            if constexpr (std::is_integral_v<T>)
+            {
+                /// the smallest integer divided by -1 doesn't fit
+                const bool out_of_range{ result > std::numeric_limits<T>::max() };
+                errors[i] |= out_of_range ? overflow : no_error;
+                out[i] = (zero || out_of_range) ? T{ 0 } : static_cast<T>(result);
+            }
+            else
+                out[i] = zero ? std::numeric_limits<T>::quiet_NaN() : result;
+        }
+    }
+
+public:
+    /// compiles the formula, column_names[i] is the name used for columns[i] in evaluate()
+    /// returns no value if the formula isn't valid, error then says why
+    static std::optional<ColumnExpression> compile(std::string_view formula, const std::vector<std::string_view>& column_names,
+                                                   std::string* error = nullptr)
+    {
+        ColumnExpression result{};
+        result.m_column_count = column_names.size();
+
+        std::string message{ Parser{ formula, column_names, result }.parse() };
+
+        if (!message.empty())
+        {
+            if (error)
+                *error = std::move(message);
+
+            return {};
+        }
+
+        return result;
+    }
+
+    /// out[row] = formula applied to columns[0][row], columns[1][row], ... for every row
+    /// errors[row] gets the RowError flags of that row, rows without errors get no_error
+    void evaluate(const std::vector<const T*>& columns, std::size_t rows, T* out, std::uint8_t* errors) const
+    {
+        assert(columns.size() >= m_column_count && "evaluate() needs a column for every name given to compile()");
+
+        /// one scratch chunk per stack slot, plus one chunk per constant filled once
+        std::vector<T> scratch(m_stack_depth * s_chunk_size);
+        std::vector<T> constants(m_constants.size() * s_chunk_size);
+
+        for (std::size_t index{ 0 }; index < m_constants.size(); ++index)
+            std::fill_n(constants.begin() + static_cast<std::ptrdiff_t>(index * s_chunk_size), s_chunk_size, m_constants[index]);
+
+        /// the stack holds pointers, a column or constant is used where it is, without being copied
+        std::vector<const T*> stack(m_stack_depth);
+
+        for (std::size_t first{ 0 }; first < rows; first += s_chunk_size)
+        {
+            const std::size_t count{ std::min(s_chunk_size, rows - first) };
+            std::uint8_t* chunk_errors{ errors + first };
+            std::fill_n(chunk_errors, count, std::uint8_t{ no_error });
+
+            std::size_t top{ 0 };
+
+            for (const Instruction& instruction : m_code)
+            {
+                switch (instruction.op)
+                {
+                case OpCode::column:
+                    stack[top++] = columns[instruction.operand] + first;
+                    break;
+                case OpCode::constant:
+                    stack[top++] = constants.data() + instruction.operand * s_chunk_size;
+                    break;
+                case OpCode::negate:
+                {
+                    T* target{ scratch.data() + (top - 1) * s_chunk_size };
+                    const T* source{ stack[top - 1] };
+                    /// negating the smallest integer overflows too
+                    binary(source, source, target, chunk_errors, count, [](Wide a, Wide) { return -a; });
+                    stack[top - 1] = target;
+                    break;
+                }
+                default:
+                {
+                    /// result goes into the scratch chunk of the left operand's slot
+                    T* target{ scratch.data() + (top - 2) * s_chunk_size };
+                    const T* left{ stack[top - 2] };
+                    const T* right{ stack[top - 1] };
+
+                    if (instruction.op == OpCode::add)
+                        binary(left, right, target, chunk_errors, count, [](Wide a, Wide b) { return a + b; });
+                    else if (instruction.op == OpCode::subtract)
+                        binary(left, right, target, chunk_errors, count, [](Wide a, Wide b) { return a - b; });
+                    else if (instruction.op == OpCode::multiply)
+                        binary(left, right, target, chunk_errors, count, [](Wide a, Wide b) { return a * b; });
+                    else
+                        divide(left, right, target, chunk_errors, count);
+
+                    stack[top - 2] = target;
+                    --top;
+                    break;
+                }
+                }
+            }
+
+            std::copy_n(stack[0], count, out + first);
+        }
+    }
+
+    std::size_t column_count() const { return m_column_count; }
+    std::size_t instruction_count() const { return m_code.size(); }
+};
+
+#endif /* ColumnExpression_h */
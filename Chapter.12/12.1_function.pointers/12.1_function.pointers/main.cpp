@@ -176,6 +176,10 @@
 #include <cassert>
 #include <utility>
 #include <functional>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "ColumnExpression.h"
 using arithmetic_function = std::function<int(int, int)>;
 
 /// foo - an identifier, function's name
@@ -460,6 +464,37 @@ int main()
     std::cout << infer_ptr() << '\n';
     std::cout << (*infer_ptr)() << '\n';
     
+    /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    /// the same arithmetic applied to whole columns, the formula is parsed and compiled once
+    /// instead of looking up a function for every pair of numbers
+    std::string error{};
+    const auto formula{ ColumnExpression<int>::compile("(x + y) * 2 / (x - y)", { "x", "y" }, &error) };
+    
+    if (formula)
+    {
+        const std::vector<int> xs{ 10, 4, 7, 9, 100, 3, 2147483647, 8 };
+        const std::vector<int> ys{ 2, 4, 1, 3, 50, 5, -2147483647, 8 };
+        std::vector<int> results(xs.size());
+        std::vector<std::uint8_t> row_errors(xs.size());
+        
+        formula->evaluate({ xs.data(), ys.data() }, xs.size(), results.data(), row_errors.data());
+        
+        for (std::size_t row{ 0 }; row < xs.size(); ++row)
+        {
+            std::cout << "(" << xs[row] << " + " << ys[row] << ") * 2 / (" << xs[row] << " - " << ys[row] << ") : ";
+            
+            /// an overflowed part is 0, so it can cause a division by zero later in the same row
+            if (row_errors[row] & ColumnExpression<int>::overflow)
+                std::cout << "overflow\n";
+            else if (row_errors[row] & ColumnExpression<int>::division_by_zero)
+                std::cout << "division by zero\n";
+            else
+                std::cout << results[row] << '\n';
+        }
+    }
+    else
+        std::cout << error << '\n';
+    
     /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     int x{ get_integer() };
     int y{ get_integer() };
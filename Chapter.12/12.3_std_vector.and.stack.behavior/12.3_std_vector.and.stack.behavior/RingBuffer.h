@@ -0,0 +1,130 @@
+//
+//  RingBuffer.h
+//  12.3_std_vector.and.stack.behavior
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef RingBuffer_h
+#define RingBuffer_h
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+/// bounded double ended queue, all memory is allocated once in the constructor and never resized
+/// capacity is rounded up to a power of two, so wrapping an index around is a single bitwise AND
+/// instead of a division
+template <typename T>
+class RingBuffer
+{
+private:
+    std::unique_ptr<T[]> m_data{};
+    std::size_t m_capacity{};
+    std::size_t m_mask{};
+
+    /// m_head and m_tail only ever count up, (m_tail - m_head) is the length even after they wrap
+    std::size_t m_head{};
+    std::size_t m_tail{};
+
+    static std::size_t round_up_to_power_of_two(std::size_t value)
+    {
+        std::size_t power{ 1 };
+        while (power < value)
+            power <<= 1;
+
+        return power;
+    }
+
+public:
+    explicit RingBuffer(std::size_t capacity)
+        : m_capacity{ round_up_to_power_of_two(capacity) }
+    {
+        assert(capacity > 0);
+
+        m_data = std::make_unique<T[]>(m_capacity);
+        m_mask = m_capacity - 1;
+    }
+
+    /// returns false instead of growing when the buffer is full
+    bool push_back(T value)
+    {
+        if (full())
+            return false;
+
+        m_data[m_tail & m_mask] = std::move(value);
+        ++m_tail;
+
+        return true;
+    }
+
+    bool push_front(T value)
+    {
+        if (full())
+            return false;
+
+        --m_head;
+        m_data[m_head & m_mask] = std::move(value);
+
+        return true;
+    }
+
+    void pop_back()
+    {
+        assert(!empty() && "pop_back() on an empty buffer");
+        --m_tail;
+    }
+
+    void pop_front()
+    {
+        assert(!empty() && "pop_front() on an empty buffer");
+        ++m_head;
+    }
+
+    T& front()
+    {
+        assert(!empty());
+        return m_data[m_head & m_mask];
+    }
+
+    const T& front() const
+    {
+        assert(!empty());
+        return m_data[m_head & m_mask];
+    }
+
+    T& back()
+    {
+        assert(!empty());
+        return m_data[(m_tail - 1) & m_mask];
+    }
+
+    const T& back() const
+    {
+        assert(!empty());
+        return m_data[(m_tail - 1) & m_mask];
+    }
+
+    /// index 0 is the front of the queue
+    T& operator[](std::size_t index)
+    {
+        assert(index < size());
+        return m_data[(m_head + index) & m_mask];
+    }
+
+    const T& operator[](std::size_t index) const
+    {
+        assert(index < size());
+        return m_data[(m_head + index) & m_mask];
+    }
+
+    void clear() { m_head = m_tail = 0; }
+
+    bool empty() const { return m_head == m_tail; }
+    bool full() const { return size() == m_capacity; }
+    std::size_t size() const { return m_tail - m_head; }
+    std::size_t capacity() const { return m_capacity; }
+};
+
+#endif /* RingBuffer_h */
@@ -0,0 +1,161 @@
+//
+//  SegmentedStack.h
+//  12.3_std_vector.and.stack.behavior
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef SegmentedStack_h
+#define SegmentedStack_h
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/// stack that grows one fixed size chunk at a time
+/// pushing never moves the existing elements, so references to them stay valid until they are popped
+/// only the small table of chunk pointers is reallocated as the stack grows
+template <typename T, std::size_t ChunkSize = 1024>
+class SegmentedStack
+{
+    static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0, "ChunkSize must be a power of two");
+
+private:
+    /// raw, suitably aligned memory for ChunkSize elements, elements are constructed in place
+    struct Chunk
+    {
+        alignas(T) unsigned char bytes[sizeof(T) * ChunkSize];
+    };
+
+    static constexpr std::size_t s_shift{ [] { std::size_t shift{ 0 }; while ((std::size_t{ 1 } << shift) < ChunkSize) ++shift; return shift; }() };
+    static constexpr std::size_t s_mask{ ChunkSize - 1 };
+
+    std::vector<std::unique_ptr<Chunk>> m_chunks{};
+    std::size_t m_length{};
+
+    T* slot(std::size_t index)
+    {
+        return std::launder(reinterpret_cast<T*>(m_chunks[index >> s_shift]->bytes) + (index & s_mask));
+    }
+
+    const T* slot(std::size_t index) const
+    {
+        return std::launder(reinterpret_cast<const T*>(m_chunks[index >> s_shift]->bytes) + (index & s_mask));
+    }
+
+public:
+    SegmentedStack() = default;
+
+    /// elements live at fixed addresses, so copying would have to rebuild every chunk, we don't allow it
+    SegmentedStack(const SegmentedStack&) = delete;
+    SegmentedStack& operator=(const SegmentedStack&) = delete;
+
+    /// moving only hands over the chunk table, the elements themselves stay where they are
+    SegmentedStack(SegmentedStack&& stack) noexcept
+        : m_chunks{ std::move(stack.m_chunks) }, m_length{ stack.m_length }
+    {
+        stack.m_length = 0;
+    }
+
+    SegmentedStack& operator=(SegmentedStack&& stack) noexcept
+    {
+        if (&stack == this)
+            return *this;
+
+        clear();
+        m_chunks = std::move(stack.m_chunks);
+        m_length = stack.m_length;
+        stack.m_length = 0;
+
+        return *this;
+    }
+
+    ~SegmentedStack()
+    {
+        clear();
+    }
+
+    /// allocates enough chunks up front to hold the given number of elements, like std::vector::reserve()
+    void reserve(std::size_t capacity)
+    {
+        while (this->capacity() < capacity)
+            m_chunks.push_back(std::make_unique<Chunk>());
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        /// a new chunk is only needed when the top one is full, nothing is copied
+        if (m_length == capacity())
+            m_chunks.push_back(std::make_unique<Chunk>());
+
+        T* element{ ::new (static_cast<void*>(slot(m_length))) T(std::forward<Args>(args)...) };
+        ++m_length;
+
+        return *element;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void pop_back()
+    {
+        assert(m_length > 0 && "pop_back() on an empty stack");
+
+        --m_length;
+        slot(m_length)->~T();
+
+        /// keep one spare chunk above the top, so pushing and popping across a chunk boundary doesn't
+        /// allocate and free the same chunk over and over
+        while (m_chunks.size() > (m_length >> s_shift) + 2)
+            m_chunks.pop_back();
+    }
+
+    T& back()
+    {
+        assert(m_length > 0 && "back() on an empty stack");
+        return *slot(m_length - 1);
+    }
+
+    const T& back() const
+    {
+        assert(m_length > 0 && "back() on an empty stack");
+        return *slot(m_length - 1);
+    }
+
+    T& operator[](std::size_t index)
+    {
+        assert(index < m_length);
+        return *slot(index);
+    }
+
+    const T& operator[](std::size_t index) const
+    {
+        assert(index < m_length);
+        return *slot(index);
+    }
+
+    /// destroys every element and releases all chunks
+    void clear()
+    {
+        while (m_length > 0)
+        {
+            --m_length;
+            slot(m_length)->~T();
+        }
+
+        m_chunks.clear();
+    }
+
+    bool empty() const { return m_length == 0; }
+    std::size_t size() const { return m_length; }
+    std::size_t capacity() const { return m_chunks.size() * ChunkSize; }
+    std::size_t chunk_count() const { return m_chunks.size(); }
+
+    static constexpr std::size_t chunk_size() { return ChunkSize; }
+};
+
+#endif /* SegmentedStack_h */
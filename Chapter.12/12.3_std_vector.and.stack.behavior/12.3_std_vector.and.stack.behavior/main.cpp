@@ -63,11 +63,33 @@
  requires that std::vector grows the capacity exponentially, like double the capacity on
  every resize operation, some compiler results in 1.5x growth, some 2x
  
+ ___________________________________________________________________________________________
+ STACKS THAT NEVER RELOCATE:
+ 
+ Every time a vector grows, all of its elements are copied(or moved) to the new memory and
+ the old memory is freed, so every pointer, reference and iterator into the vector becomes
+ invalid, and the push_back that triggers the resize costs time proportional to the whole
+ stack, for a very large stack that one push can take a very long time
+ 
+ SegmentedStack - allocates memory in fixed size chunks, when the top chunk is full, a new
+ chunk is allocated and the old chunks are left where they are, pushing never copies the
+ existing elements and references to them stay valid until they are popped
+ 
+ Element at index i lives in chunk (i / chunk size) at position (i % chunk size), with a
+ power of two chunk size this is a shift and a mask
+ 
+ RingBuffer - fixed capacity queue/deque, memory is allocated once and never resized, push
+ fails(returns false) when the buffer is full, capacity is rounded up to a power of two so
+ that wrapping the index around the end is (index & (capacity - 1)) instead of %
+ 
  ___________________________________________________________________________________________
  */
 
+#include <cstddef>
 #include <iostream>
 #include <vector>
+#include "RingBuffer.h"
+#include "SegmentedStack.h"
 
 void print_stack(const std::vector<int>& stack)
 {
@@ -78,6 +100,27 @@ void print_stack(const std::vector<int>& stack)
     std::cout << "\tLength: " << stack.size() << '\n';
 }
 
+template <typename T, std::size_t ChunkSize>
+void print_stack(const SegmentedStack<T, ChunkSize>& stack)
+{
+    for (std::size_t index{ 0 }; index < stack.size(); ++index)
+        std::cout << stack[index] << ' ';
+    
+    std::cout << "\nCapacity: " << stack.capacity();
+    std::cout << "\tLength: " << stack.size();
+    std::cout << "\tChunks: " << stack.chunk_count() << '\n';
+}
+
+template <typename T>
+void print_stack(const RingBuffer<T>& buffer)
+{
+    for (std::size_t index{ 0 }; index < buffer.size(); ++index)
+        std::cout << buffer[index] << ' ';
+    
+    std::cout << "\nCapacity: " << buffer.capacity();
+    std::cout << "\tLength: " << buffer.size() << '\n';
+}
+
 int main()
 {
     /// this dynamic array has length 10, even though its 5 elements are used
@@ -141,5 +184,41 @@ int main()
     /// capacity is 10, more than the capacity needed, this happened to minimize the number of resize operations
     std::cout << extra_capacity.capacity() << '\n';
     
+    /// chunk size of 4 so we can see new chunks being added
+    SegmentedStack<int, 4> segmented{};
+    segmented.push_back(1);
+    
+    /// reference to the bottom element
+    int& bottom{ segmented.back() };
+    
+    for (int value{ 2 }; value <= 10; ++value)
+        segmented.push_back(value);
+    
+    /// capacity 12 in 3 chunks, bottom element was never moved so the reference is still valid
+    print_stack(segmented);
+    std::cout << "Bottom: " << bottom << '\n';
+    
+    /// popping keeps one spare chunk above the top
+    segmented.pop_back();
+    segmented.pop_back();
+    print_stack(segmented);
+    
+    /// capacity 5 is rounded up to 8
+    RingBuffer<int> ring{ 5 };
+    
+    for (int value{ 1 }; value <= 10; ++value)
+    {
+        /// push fails when the buffer is full, it never grows
+        if (!ring.push_back(value))
+            std::cout << "Full, " << value << " is not pushed\n";
+    }
+    print_stack(ring);
+    
+    /// it can also be used from the front
+    ring.pop_front();
+    ring.pop_front();
+    ring.push_front(0);
+    print_stack(ring);
+    
     return 0;
 }
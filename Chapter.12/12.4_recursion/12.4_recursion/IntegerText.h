@@ -0,0 +1,364 @@
+//
+//  IntegerText.h
+//  12.4_recursion
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef IntegerText_h
+#define IntegerText_h
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/// Integers to binary, hex and decimal text and back, a whole byte or two digits per step instead of
+/// one bit or digit at a time
+/// - decimal: two digits per division by 100, looked up in a table of "00" to "99"
+/// - hex: two digits per byte from a table of "00" to "ff"
+/// - binary: eight digits per byte, from a table or, with SSE2, 16 digits at once by comparing
+///   every bit against a mask
+/// - the append_ functions convert whole arrays into one std::string, resized once
+/// every to_ function writes into a char buffer and returns the end of what it wrote, nothing is
+/// allocated; buffers of max_decimal_digits / max_hex_digits / max_binary_digits chars are always big enough
+namespace IntegerText
+{
+    /// most characters each conversion can write for a type, including a '-' sign
+    template <typename T> constexpr std::size_t max_decimal_digits{ std::numeric_limits<T>::digits10 + 2 };
+    template <typename T> constexpr std::size_t max_hex_digits{ sizeof(T) * 2 };
+    template <typename T> constexpr std::size_t max_binary_digits{ sizeof(T) * 8 };
+
+    namespace detail
+    {
+        struct Tables
+        {
+            char decimal_pairs[200]{};
+            char hex_pairs[512]{};
+            char binary_bytes[256 * 8]{};
+            std::uint8_t hex_values[256]{};
+
+            constexpr Tables()
+            {
+                for (int i{ 0 }; i < 100; ++i)
+                {
+                    decimal_pairs[i * 2] = static_cast<char>('0' + i / 10);
+                    decimal_pairs[i * 2 + 1] = static_cast<char>('0' + i % 10);
+                }
+
+                constexpr char digits[]{ "0123456789abcdef" };
+                for (int i{ 0 }; i < 256; ++i)
+                {
+                    hex_pairs[i * 2] = digits[i >> 4];
+                    hex_pairs[i * 2 + 1] = digits[i & 0xF];
+
+                    for (int bit{ 0 }; bit < 8; ++bit)
+                        binary_bytes[i * 8 + bit] = ((i >> (7 - bit)) & 1) ? '1' : '0';
+
+                    hex_values[i] = 0xFF;
+                }
+
+                for (int i{ 0 }; i < 10; ++i)
+                    hex_values['0' + i] = static_cast<std::uint8_t>(i);
+
+                for (int i{ 0 }; i < 6; ++i)
+                {
+                    hex_values['a' + i] = static_cast<std::uint8_t>(10 + i);
+                    hex_values['A' + i] = static_cast<std::uint8_t>(10 + i);
+                }
+            }
+        };
+
+        inline constexpr Tables s_tables{};
+
+        template <typename T>
+        using Unsigned = std::make_unsigned_t<T>;
+
+        /// number of decimal digits of value, at least 1
+        template <typename U>
+        int decimal_length(U value)
+        {
+            int length{ 1 };
+            while (true)
+            {
+                if (value < 10) return length;
+                if (value < 100) return length + 1;
+                if (value < 1000) return length + 2;
+                if (value < 10000) return length + 3;
+
+                value /= 10000;
+                length += 4;
+            }
+        }
+
+        /// the 8 binary digits of byte
+        inline void binary_byte(char* out, unsigned int byte)
+        {
+            std::memcpy(out, s_tables.binary_bytes + byte * 8, 8);
+        }
+
+#if defined(__SSE2__)
+        /// the 16 binary digits of two bytes, high byte first
+        inline void binary_16(char* out, unsigned int high, unsigned int low)
+        {
+            /// every byte of the first half is the high byte, every byte of the second half the low byte
+            const __m128i bytes{ _mm_set_epi64x(static_cast<long long>(low * 0x0101010101010101ull),
+                                                static_cast<long long>(high * 0x0101010101010101ull)) };
+            /// most significant bit first
+            const __m128i bits{ _mm_set_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128) };
+
+            /// 0xFF where the bit is set, '0' - (-1) is '1'
+            const __m128i set{ _mm_cmpeq_epi8(_mm_and_si128(bytes, bits), bits) };
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_sub_epi8(_mm_set1_epi8('0'), set));
+        }
+#endif
+    }
+
+    /// decimal digits, with a '-' for negative values, like std::cout << value
+    template <typename T>
+    char* to_decimal(char* out, T value)
+    {
+        static_assert(std::is_integral_v<T>, "IntegerText converts integers");
+
+        using U = detail::Unsigned<T>;
+        U magnitude{ static_cast<U>(value) };
+
+        if constexpr (std::is_signed_v<T>)
+        {
+            if (value < 0)
+            {
+                *out++ = '-';
+                magnitude = static_cast<U>(U{ 0 } - magnitude);
+            }
+        }
+
+        const int length{ detail::decimal_length(magnitude) };
+        char* position{ out + length };
+
+        while (magnitude >= 100)
+        {
+            const unsigned int pair{ static_cast<unsigned int>(magnitude % 100) };
+            magnitude /= 100;
+            position -= 2;
+            std::memcpy(position, detail::s_tables.decimal_pairs + pair * 2, 2);
+        }
+
+        if (magnitude >= 10)
+            std::memcpy(position - 2, detail::s_tables.decimal_pairs + magnitude * 2, 2);
+        else
+            position[-1] = static_cast<char>('0' + magnitude);
+
+        return out + length;
+    }
+
+    /// all 2 * sizeof(T) hex digits, lowercase, with leading zeros
+    template <typename T>
+    char* to_hex(char* out, T value)
+    {
+        static_assert(std::is_integral_v<T>, "IntegerText converts integers");
+
+        const detail::Unsigned<T> bits{ static_cast<detail::Unsigned<T>>(value) };
+        for (int byte{ static_cast<int>(sizeof(T)) - 1 }; byte >= 0; --byte)
+        {
+            std::memcpy(out, detail::s_tables.hex_pairs + ((bits >> (byte * 8)) & 0xFF) * 2, 2);
+            out += 2;
+        }
+
+        return out;
+    }
+
+    /// hex digits without leading zeros, "0" for 0
+    template <typename T>
+    char* to_hex_trimmed(char* out, T value)
+    {
+        char digits[max_hex_digits<T>];
+        to_hex(digits, value);
+
+        std::size_t first{ 0 };
+        while (first + 1 < max_hex_digits<T> && digits[first] == '0')
+            ++first;
+
+        const std::size_t length{ max_hex_digits<T> - first };
+        std::memcpy(out, digits + first, length);
+        return out + length;
+    }
+
+    /// the lowest bit_count binary digits, with leading zeros, by default all of them
+    template <typename T>
+    char* to_binary(char* out, T value, int bit_count = static_cast<int>(max_binary_digits<T>))
+    {
+        static_assert(std::is_integral_v<T>, "IntegerText converts integers");
+
+        const std::uint64_t bits{ static_cast<detail::Unsigned<T>>(value) };
+        bit_count = bit_count < 0 ? 0 : (bit_count > static_cast<int>(max_binary_digits<T>) ? static_cast<int>(max_binary_digits<T>) : bit_count);
+
+        /// digits that don't fill a whole byte come first
+        for (int bit{ bit_count - 1 }; bit >= 0 && (bit + 1) % 8 != 0; --bit, --bit_count)
+            *out++ = ((bits >> bit) & 1) ? '1' : '0';
+
+        int byte{ bit_count / 8 - 1 };
+
+#if defined(__SSE2__)
+        for (; byte >= 1; byte -= 2, out += 16)
+            detail::binary_16(out, static_cast<unsigned int>((bits >> (byte * 8)) & 0xFF), static_cast<unsigned int>((bits >> ((byte - 1) * 8)) & 0xFF));
+#endif
+
+        for (; byte >= 0; --byte, out += 8)
+            detail::binary_byte(out, static_cast<unsigned int>((bits >> (byte * 8)) & 0xFF));
+
+        return out;
+    }
+
+    /// binary digits without leading zeros, "0" for 0
+    template <typename T>
+    char* to_binary_trimmed(char* out, T value)
+    {
+        const detail::Unsigned<T> bits{ static_cast<detail::Unsigned<T>>(value) };
+
+        int bit_count{ 1 };
+        while (bit_count < static_cast<int>(max_binary_digits<T>) && (bits >> bit_count) != 0)
+            ++bit_count;
+
+        return to_binary(out, value, bit_count);
+    }
+
+    /// reads decimal digits (and a leading '-' for signed types), like std::from_chars
+    template <typename T>
+    std::from_chars_result from_decimal(const char* first, const char* last, T& value)
+    {
+        return std::from_chars(first, last, value, 10);
+    }
+
+    /// reads hex digits, either case, without "0x", as the bits of T: "ff" is -1 for std::int8_t
+    /// stops at the first character that isn't a hex digit, result.ec is std::errc::result_out_of_range
+    /// if the number doesn't fit into T, std::errc::invalid_argument if there are no digits at all
+    template <typename T>
+    std::from_chars_result from_hex(const char* first, const char* last, T& value)
+    {
+        using U = detail::Unsigned<T>;
+
+        const char* position{ first };
+        U result{ 0 };
+        bool overflow{ false };
+
+        for (; position != last; ++position)
+        {
+            const std::uint8_t digit{ detail::s_tables.hex_values[static_cast<unsigned char>(*position)] };
+            if (digit == 0xFF)
+                break;
+
+            overflow = overflow || (result >> (max_binary_digits<T> - 4)) != 0;
+            result = static_cast<U>((result << 4) | digit);
+        }
+
+        if (position == first)
+            return { first, std::errc::invalid_argument };
+
+        if (overflow)
+            return { position, std::errc::result_out_of_range };
+
+        value = static_cast<T>(result);
+        return { position, std::errc{} };
+    }
+
+    /// reads binary digits as the bits of T, 8 at a time while there are enough of them
+    /// errors are reported the same way as from_hex()
+    template <typename T>
+    std::from_chars_result from_binary(const char* first, const char* last, T& value)
+    {
+        using U = detail::Unsigned<T>;
+
+        const char* position{ first };
+        std::uint64_t result{ 0 };
+
+        while (last - position >= 8)
+        {
+            std::uint64_t chunk{};
+            std::memcpy(&chunk, position, 8);
+
+            /// every byte must be '0' (0x30) or '1' (0x31)
+            const std::uint64_t bits{ chunk - 0x3030303030303030ull };
+            if ((bits & 0xFEFEFEFEFEFEFEFEull) != 0 || (chunk & 0xC0C0C0C0C0C0C0C0ull) != 0)
+                break;
+
+            /// the lowest bit of each byte into one byte, the first character becomes the highest bit
+            /// (the bytes are read in little endian order)
+            const std::uint8_t byte{ static_cast<std::uint8_t>((bits * 0x8040201008040201ull) >> 56) };
+
+            if ((result >> (max_binary_digits<T> - 8)) != 0)
+                return { position, std::errc::result_out_of_range };
+
+            result = (result << 8) | byte;
+            position += 8;
+        }
+
+        for (; position != last && (*position == '0' || *position == '1'); ++position)
+        {
+            if ((result >> (max_binary_digits<T> - 1)) != 0)
+                return { position, std::errc::result_out_of_range };
+
+            result = (result << 1) | static_cast<std::uint64_t>(*position - '0');
+        }
+
+        if (position == first)
+            return { first, std::errc::invalid_argument };
+
+        value = static_cast<T>(static_cast<U>(result));
+        return { position, std::errc{} };
+    }
+
+    /// every value of the array followed by separator, appended to text in one go
+    template <typename T>
+    void append_decimal(std::string& text, const T* values, std::size_t count, char separator = '\n')
+    {
+        const std::size_t start{ text.size() };
+        text.resize(start + count * (max_decimal_digits<T> + 1));
+
+        char* out{ text.data() + start };
+        for (std::size_t i{ 0 }; i < count; ++i)
+        {
+            out = to_decimal(out, values[i]);
+            *out++ = separator;
+        }
+
+        text.resize(static_cast<std::size_t>(out - text.data()));
+    }
+
+    template <typename T>
+    void append_hex(std::string& text, const T* values, std::size_t count, char separator = '\n')
+    {
+        const std::size_t start{ text.size() };
+        text.resize(start + count * (max_hex_digits<T> + 1));
+
+        char* out{ text.data() + start };
+        for (std::size_t i{ 0 }; i < count; ++i)
+        {
+            out = to_hex(out, values[i]);
+            *out++ = separator;
+        }
+    }
+
+    template <typename T>
+    void append_binary(std::string& text, const T* values, std::size_t count, char separator = '\n')
+    {
+        const std::size_t start{ text.size() };
+        text.resize(start + count * (max_binary_digits<T> + 1));
+
+        char* out{ text.data() + start };
+        for (std::size_t i{ 0 }; i < count; ++i)
+        {
+            out = to_binary(out, values[i]);
+            *out++ = separator;
+        }
+    }
+}
+
+#endif /* IntegerText_h */
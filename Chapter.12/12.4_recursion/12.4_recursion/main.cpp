@@ -79,6 +79,8 @@
 
 #include <iostream>
 #include <vector>
+#include <string_view>
+#include "IntegerText.h"
 
 void infinite_recursion(int x)
 {
@@ -176,6 +178,19 @@ void print_to_bin(unsigned int x)
     std::cout << x % 2;
 }
 
+/// the same digits without recursion: eight at a time from a lookup table, written into a buffer
+/// and printed with a single insertion
+void print_to_bin_fast(unsigned int x)
+{
+    if (x == 0)
+        return;
+    
+    char digits[IntegerText::max_binary_digits<unsigned int>]{};
+    const char* end{ IntegerText::to_binary_trimmed(digits, x) };
+    
+    std::cout << std::string_view{ digits, static_cast<std::size_t>(end - digits) };
+}
+
 int main()
 {
     /// infinite recursive function call, stack overflow
@@ -206,6 +221,9 @@ int main()
     int y{ dec_to_bin() };
     
     print_to_bin(static_cast<unsigned int>(y));
+    std::cout << '\n';
+    
+    print_to_bin_fast(static_cast<unsigned int>(y));
     
     return 0;
 }
@@ -0,0 +1,70 @@
+//
+//  MappedFile.h
+//  12.5_command.line.arguments
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef MappedFile_h
+#define MappedFile_h
+
+#include <cstddef>
+#include <string_view>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// read only view of a whole file, the OS maps the file into our address space and pages it in
+/// on demand, nothing is copied into a buffer of our own
+/// POSIX only (macOS, Linux)
+class MappedFile
+{
+private:
+    const char* m_data{};
+    std::size_t m_size{};
+
+public:
+    explicit MappedFile(const char* path)
+    {
+        int fd{ ::open(path, O_RDONLY) };
+        if (fd < 0)
+            return;
+
+        struct stat info{};
+        if (::fstat(fd, &info) == 0 && info.st_size > 0)
+        {
+            void* address{ ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0) };
+
+            if (address != MAP_FAILED)
+            {
+                m_data = static_cast<const char*>(address);
+                m_size = static_cast<std::size_t>(info.st_size);
+
+                /// we read front to back, let the OS read ahead aggressively
+                ::madvise(address, m_size, MADV_SEQUENTIAL);
+            }
+        }
+
+        /// the mapping stays valid after the descriptor is closed
+        ::close(fd);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile()
+    {
+        if (m_data)
+            ::munmap(const_cast<char*>(m_data), m_size);
+    }
+
+    /// false if the file couldn't be opened or mapped, an empty file is also reported as not open
+    bool is_open() const { return m_data != nullptr; }
+
+    std::string_view view() const { return { m_data, m_size }; }
+    std::size_t size() const { return m_size; }
+};
+
+#endif /* MappedFile_h */
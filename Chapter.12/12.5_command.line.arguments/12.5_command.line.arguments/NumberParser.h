@@ -0,0 +1,302 @@
+//
+//  NumberParser.h
+//  12.5_command.line.arguments
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef NumberParser_h
+#define NumberParser_h
+
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+/// Locale independent number parsing, a replacement for std::stringstream conversions
+/// No stream object is constructed and no locale is consulted, the text is read directly
+/// Digits are parsed 8 at a time using SWAR (SIMD within a register): 8 characters are loaded into
+/// one 64-bit integer, checked and converted with a handful of multiplications; this goes for
+/// integers and for both the integer part and the fraction of floating point numbers
+namespace NumberParser
+{
+    namespace detail
+    {
+        /// 8 characters as one little endian 64-bit integer, first character in the lowest byte
+        inline std::uint64_t load8(const char* first)
+        {
+            std::uint64_t value{};
+            std::memcpy(&value, first, sizeof(value));
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            value = __builtin_bswap64(value);
+#endif
+            return value;
+        }
+
+        /// true if all 8 bytes are between '0' (0x30) and '9' (0x39)
+        /// adding 6 pushes anything above '9' into the next 0x40 range
+        inline bool is_eight_digits(std::uint64_t value)
+        {
+            return ((value & 0xF0F0F0F0F0F0F0F0) | (((value + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4))
+                == 0x3333333333333333;
+        }
+
+        /// converts 8 digit characters into their value, pairs of digits are combined first, then
+        /// pairs of pairs, then the two halves
+        inline std::uint32_t parse_eight_digits(std::uint64_t value)
+        {
+            value = (value & 0x0F0F0F0F0F0F0F0F) * 2561 >> 8;
+            value = (value & 0x00FF00FF00FF00FF) * 6553601 >> 16;
+            return static_cast<std::uint32_t>((value & 0x0000FFFF0000FFFF) * 42949672960001 >> 32);
+        }
+
+        inline bool is_digit(char ch)
+        {
+            return static_cast<unsigned char>(ch - '0') < 10;
+        }
+
+        /// appends digits to value until it holds 19, 19 digits always fit in a std::uint64_t
+        /// returns a pointer past the last digit consumed
+        inline const char* append_digits(const char* first, const char* last, std::uint64_t& value, int& digit_count)
+        {
+            while (last - first >= 8 && digit_count <= 11 && is_eight_digits(load8(first)))
+            {
+                value = value * 100000000 + parse_eight_digits(load8(first));
+                first += 8;
+                digit_count += 8;
+            }
+
+            while (first != last && is_digit(*first) && digit_count < 19)
+            {
+                value = value * 10 + static_cast<std::uint64_t>(*first - '0');
+                ++first;
+                ++digit_count;
+            }
+
+            return first;
+        }
+
+        /// reads up to 19 digits into value
+        inline const char* parse_digits(const char* first, const char* last, std::uint64_t& value, int& digit_count)
+        {
+            value = 0;
+            digit_count = 0;
+
+            return append_digits(first, last, value, digit_count);
+        }
+
+        /// exact powers of ten representable in a double
+        inline constexpr double s_powers_of_ten[]{
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    }
+
+    /// same result type as std::from_chars, ptr points past the last character consumed
+    using Result = std::from_chars_result;
+
+    /// parses an integer at the start of [first, last), an optional leading '-' is accepted for signed types
+    template <typename T>
+    Result parse(const char* first, const char* last, T& value)
+    {
+        static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "parse() integer overload needs an integer type");
+
+        const char* begin{ first };
+        bool negative{ false };
+
+        if constexpr (std::is_signed_v<T>)
+        {
+            if (first != last && *first == '-')
+            {
+                negative = true;
+                ++first;
+            }
+        }
+
+        std::uint64_t magnitude{};
+        int digit_count{};
+        const char* end{ detail::parse_digits(first, last, magnitude, digit_count) };
+
+        if (digit_count == 0)
+            return { begin, std::errc::invalid_argument };
+
+        /// more than 19 digits, let std::from_chars handle the rare long number and the overflow
+        if (end != last && detail::is_digit(*end))
+            return std::from_chars(begin, last, value);
+
+        using Unsigned = std::make_unsigned_t<T>;
+        const std::uint64_t limit{ negative
+            ? static_cast<std::uint64_t>(std::numeric_limits<T>::max()) + 1
+            : static_cast<std::uint64_t>(std::numeric_limits<T>::max()) };
+
+        if (magnitude > limit)
+            return { end, std::errc::result_out_of_range };
+
+        /// negate in unsigned arithmetic, so the most negative value doesn't overflow
+        Unsigned bits{ static_cast<Unsigned>(magnitude) };
+        value = static_cast<T>(negative ? static_cast<Unsigned>(0 - bits) : bits);
+
+        return { end, std::errc{} };
+    }
+
+    /// parses a decimal floating point number like -12.375 or 6.02e23
+    /// numbers with at most 19 significant digits and a small exponent are computed exactly as
+    /// mantissa * 10^exponent, anything else is handed to the library
+    inline Result parse(const char* first, const char* last, double& value)
+    {
+        const char* begin{ first };
+        bool negative{ false };
+
+        if (first != last && (*first == '-' || *first == '+'))
+        {
+            negative = (*first == '-');
+            ++first;
+        }
+
+        /// the library only takes a leading '-', so a '+' is skipped when it gets the number
+        const char* number{ negative ? begin : first };
+
+        std::uint64_t mantissa{};
+        int integer_digits{};
+        first = detail::parse_digits(first, last, mantissa, integer_digits);
+
+        bool exact{ first == last || !detail::is_digit(*first) };
+        int exponent{ 0 };
+        int fraction_digits{ 0 };
+
+        if (exact && first != last && *first == '.')
+        {
+            ++first;
+
+            /// keep accumulating the fraction digits into the same mantissa, 8 at a time
+            const char* fraction_first{ first };
+            int significant_digits{ integer_digits };
+            first = detail::append_digits(first, last, mantissa, significant_digits);
+
+            /// digits after the 19th don't fit into the mantissa, the library gets those numbers
+            if (first != last && detail::is_digit(*first))
+            {
+                exact = false;
+                while (first != last && detail::is_digit(*first))
+                    ++first;
+            }
+
+            fraction_digits = static_cast<int>(first - fraction_first);
+            exponent = -fraction_digits;
+        }
+
+        if (integer_digits + fraction_digits == 0)
+            return { begin, std::errc::invalid_argument };
+
+        if (exact && first != last && (*first == 'e' || *first == 'E'))
+        {
+            int explicit_exponent{};
+            Result result{ parse(first + 1, last, explicit_exponent) };
+
+            /// "1e" or "1e+5" are left to the library
+            if (result.ec != std::errc{})
+                exact = false;
+            else
+            {
+                exponent += explicit_exponent;
+                first = result.ptr;
+            }
+        }
+
+        /// Clinger's fast path: both the mantissa and the power of ten are exact doubles, so one
+        /// rounding step gives the correctly rounded result
+        if (exact && mantissa <= (std::uint64_t{ 1 } << 53) && exponent >= -22 && exponent <= 22)
+        {
+            double result{ static_cast<double>(mantissa) };
+            result = (exponent < 0) ? result / detail::s_powers_of_ten[-exponent] : result * detail::s_powers_of_ten[exponent];
+            value = negative ? -result : result;
+
+            return { first, std::errc{} };
+        }
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        Result result{ std::from_chars(number, last, value) };
+        if (result.ec == std::errc::invalid_argument)
+            result.ptr = begin;
+
+        return result;
+#else
+        /// older standard libraries don't have std::from_chars for double, std::strtod needs a
+        /// null terminated string, so the slow path copies the number first
+        std::string text{ number, last };
+        char* text_end{};
+        value = std::strtod(text.c_str(), &text_end);
+
+        if (text_end == text.c_str())
+            return { begin, std::errc::invalid_argument };
+
+        return { number + (text_end - text.c_str()), std::errc{} };
+#endif
+    }
+
+    /// convenience overload for a whole string, succeeds only if every character was consumed
+    template <typename T>
+    bool parse(std::string_view text, T& value)
+    {
+        Result result{ parse(text.data(), text.data() + text.size(), value) };
+        return result.ec == std::errc{} && result.ptr == text.data() + text.size();
+    }
+
+    /// walks through a buffer of numbers separated by whitespace or commas, without copying it
+    template <typename T>
+    class Scanner
+    {
+    private:
+        const char* m_current{};
+        const char* m_last{};
+        std::size_t m_error_count{};
+
+        static bool is_separator(char ch)
+        {
+            return ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r' || ch == ',';
+        }
+
+    public:
+        explicit Scanner(std::string_view buffer)
+            : m_current{ buffer.data() }, m_last{ buffer.data() + buffer.size() }
+        {
+        }
+
+        /// reads the next number into value, returns false at the end of the buffer
+        /// anything that isn't a number is skipped up to the next separator and counted as an error
+        bool next(T& value)
+        {
+            while (m_current != m_last)
+            {
+                while (m_current != m_last && is_separator(*m_current))
+                    ++m_current;
+
+                if (m_current == m_last)
+                    return false;
+
+                Result result{ parse(m_current, m_last, value) };
+
+                if (result.ec == std::errc{} && (result.ptr == m_last || is_separator(*result.ptr)))
+                {
+                    m_current = result.ptr;
+                    return true;
+                }
+
+                ++m_error_count;
+                while (m_current != m_last && !is_separator(*m_current))
+                    ++m_current;
+            }
+
+            return false;
+        }
+
+        std::size_t error_count() const { return m_error_count; }
+    };
+}
+
+#endif /* NumberParser_h */
@@ -0,0 +1,158 @@
+//
+//  CallableBenchmark.h
+//  12.7_intro.to.lambdas_anonymous.functions
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef CallableBenchmark_h
+#define CallableBenchmark_h
+
+#include <array>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Callable.h"
+
+/// Compares 4 ways of passing a lambda to a function:
+/// std::function, FunctionRef, InplaceFunction and a template parameter (auto)
+/// - call: repeat() calls one small lambda many times, measures the cost of each call
+/// - create + call: a new lambda with 56 bytes of captures is made, passed and called once, many
+///   times over, like a callback made per item; this is where std::function has to allocate
+/// the functions taking std::function, FunctionRef and InplaceFunction are kept out of line, as if
+/// they were in another .cpp file, the template is inlined like templates are
+namespace CallableBenchmark
+{
+    struct Result
+    {
+        std::string name{};
+        double call_ns{};
+        double create_call_ns{};
+    };
+
+    using BigCapture = std::array<double, 6>;
+
+    namespace detail
+    {
+        __attribute__((noinline)) inline void repeat_function(int repetitions, const std::function<void(int)>& fn)
+        {
+            for (int i{ 0 }; i < repetitions; ++i)
+                fn(i);
+        }
+
+        __attribute__((noinline)) inline void repeat_ref(int repetitions, FunctionRef<void(int)> fn)
+        {
+            for (int i{ 0 }; i < repetitions; ++i)
+                fn(i);
+        }
+
+        __attribute__((noinline)) inline void repeat_inplace(int repetitions, const InplaceFunction<void(int)>& fn)
+        {
+            for (int i{ 0 }; i < repetitions; ++i)
+                fn(i);
+        }
+
+        template <class F>
+        void repeat_template(int repetitions, F&& fn)
+        {
+            for (int i{ 0 }; i < repetitions; ++i)
+                fn(i);
+        }
+
+        __attribute__((noinline)) inline double call_function(const std::function<double(int)>& fn, int i) { return fn(i); }
+        __attribute__((noinline)) inline double call_ref(FunctionRef<double(int)> fn, int i) { return fn(i); }
+        __attribute__((noinline)) inline double call_inplace(const InplaceFunction<double(int), 64>& fn, int i) { return fn(i); }
+
+        template <class F>
+        double call_template(F&& fn, int i) { return fn(i); }
+
+        /// nanoseconds per repetition of body(repetitions)
+        template <class Body>
+        double time_per(int repetitions, Body body)
+        {
+            const auto start{ std::chrono::steady_clock::now() };
+            body(repetitions);
+            const auto stop{ std::chrono::steady_clock::now() };
+
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()) / repetitions;
+        }
+
+        /// the big lambda for repetition i, made fresh every time
+        inline auto make_big(const BigCapture& values, int i)
+        {
+            return [values, i](int x) { return values[static_cast<std::size_t>((x + i) % 6)] * x; };
+        }
+    }
+
+    /// keeps the results alive so the compiler can't drop the work
+    inline volatile double g_sink{};
+
+    inline std::vector<Result> run(int repetitions = 100'000'000)
+    {
+        std::vector<Result> results(4);
+        results[0].name = "std::function";
+        results[1].name = "FunctionRef";
+        results[2].name = "InplaceFunction";
+        results[3].name = "template (auto)";
+
+        long long total{ 0 };
+        auto add{ [&total](int i) { total += i; } };
+
+        results[0].call_ns = detail::time_per(repetitions, [&](int n) { detail::repeat_function(n, add); });
+        results[1].call_ns = detail::time_per(repetitions, [&](int n) { detail::repeat_ref(n, add); });
+        results[2].call_ns = detail::time_per(repetitions, [&](int n) { detail::repeat_inplace(n, add); });
+        results[3].call_ns = detail::time_per(repetitions, [&](int n) { detail::repeat_template(n, add); });
+
+        const BigCapture values{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+        const int created{ repetitions / 5 };
+        double sum{ 0.0 };
+
+        results[0].create_call_ns = detail::time_per(created, [&](int n) {
+            for (int i{ 0 }; i < n; ++i)
+                sum += detail::call_function(detail::make_big(values, i), i);
+        });
+        results[1].create_call_ns = detail::time_per(created, [&](int n) {
+            for (int i{ 0 }; i < n; ++i)
+                sum += detail::call_ref(detail::make_big(values, i), i);
+        });
+        results[2].create_call_ns = detail::time_per(created, [&](int n) {
+            for (int i{ 0 }; i < n; ++i)
+                sum += detail::call_inplace(detail::make_big(values, i), i);
+        });
+        results[3].create_call_ns = detail::time_per(created, [&](int n) {
+            for (int i{ 0 }; i < n; ++i)
+                sum += detail::call_template(detail::make_big(values, i), i);
+        });
+
+        g_sink = static_cast<double>(total) + sum;
+
+        return results;
+    }
+
+    inline void print_table(const std::vector<Result>& results, std::ostream& out = std::cout)
+    {
+        const std::ios_base::fmtflags flags{ out.flags() };
+        const std::streamsize precision{ out.precision() };
+
+        out << std::left << std::setw(18) << "passed as" << std::right
+            << std::setw(12) << "call ns"
+            << std::setw(18) << "create + call ns" << '\n';
+
+        out << std::fixed << std::setprecision(3);
+
+        for (const Result& result : results)
+        {
+            out << std::left << std::setw(18) << result.name << std::right
+                << std::setw(12) << result.call_ns
+                << std::setw(18) << result.create_call_ns << '\n';
+        }
+
+        out.flags(flags);
+        out.precision(precision);
+    }
+}
+
+#endif /* CallableBenchmark_h */
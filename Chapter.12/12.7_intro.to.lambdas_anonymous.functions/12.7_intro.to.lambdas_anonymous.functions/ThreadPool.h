@@ -0,0 +1,350 @@
+//
+//  ThreadPool.h
+//  12.7_intro.to.lambdas_anonymous.functions
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef ThreadPool_h
+#define ThreadPool_h
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "Callable.h"
+
+/// A fixed set of worker threads that stay alive between calls, so parallel_repeat doesn't pay
+/// for creating threads every time
+///
+/// every worker has its own deque of tasks: it pushes and pops at the back (the most recently
+/// split, still warm in its cache), and a worker with nothing to do steals from the front of
+/// another worker's deque (the oldest, biggest piece of work)
+///
+/// a thread waiting for its tasks to finish runs other tasks in the meantime instead of blocking,
+/// so a parallel_repeat inside a parallel_repeat can't deadlock the pool
+class ThreadPool
+{
+public:
+    using Task = InplaceFunction<void(), 64>;
+
+    /// counts the unfinished tasks of one parallel call, and keeps the first exception one threw
+    class TaskGroup
+    {
+    private:
+        std::atomic<std::size_t> m_pending{ 0 };
+        std::mutex m_error_mutex{};
+        std::exception_ptr m_error{};
+
+        friend class ThreadPool;
+
+    public:
+        void fail(std::exception_ptr error)
+        {
+            const std::lock_guard lock{ m_error_mutex };
+            if (!m_error)
+                m_error = error;
+        }
+    };
+
+private:
+    struct WorkQueue
+    {
+        std::mutex mutex{};
+        std::deque<Task> tasks{};
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> m_queues{};
+    std::vector<std::thread> m_workers{};
+
+    /// tasks waiting in any queue, sleeping workers wake up when it isn't 0
+    std::atomic<std::size_t> m_queued{ 0 };
+    std::atomic<std::size_t> m_next_queue{ 0 };
+    std::atomic<bool> m_stopping{ false };
+    std::mutex m_sleep_mutex{};
+    std::condition_variable m_wake{};
+
+    static inline thread_local const ThreadPool* s_current_pool{ nullptr };
+    static inline thread_local std::size_t s_worker_index{ 0 };
+
+    std::optional<Task> pop_back(std::size_t queue)
+    {
+        WorkQueue& work{ *m_queues[queue] };
+        const std::lock_guard lock{ work.mutex };
+
+        if (work.tasks.empty())
+            return std::nullopt;
+
+        std::optional<Task> task{ std::move(work.tasks.back()) };
+        work.tasks.pop_back();
+        m_queued.fetch_sub(1);
+
+        return task;
+    }
+
+    std::optional<Task> steal_front(std::size_t queue)
+    {
+        WorkQueue& work{ *m_queues[queue] };
+        const std::unique_lock lock{ work.mutex, std::try_to_lock };
+
+        /// a busy queue is skipped, another one is probably free
+        if (!lock.owns_lock() || work.tasks.empty())
+            return std::nullopt;
+
+        std::optional<Task> task{ std::move(work.tasks.front()) };
+        work.tasks.pop_front();
+        m_queued.fetch_sub(1);
+
+        return task;
+    }
+
+    /// the caller's own newest task, otherwise the oldest task of someone else
+    std::optional<Task> take_task()
+    {
+        const std::size_t count{ m_queues.size() };
+        const std::size_t me{ current_slot() };
+
+        if (me < count)
+            if (std::optional<Task> task{ pop_back(me) })
+                return task;
+
+        for (std::size_t attempt{ 0 }; attempt < 2 && m_queued.load() > 0; ++attempt)
+        {
+            for (std::size_t offset{ 1 }; offset <= count; ++offset)
+                if (std::optional<Task> task{ steal_front((me + offset) % count) })
+                    return task;
+        }
+
+        return std::nullopt;
+    }
+
+    bool run_one()
+    {
+        std::optional<Task> task{ take_task() };
+        if (!task)
+            return false;
+
+        (*task)();
+        return true;
+    }
+
+    void work(std::size_t index)
+    {
+        s_current_pool = this;
+        s_worker_index = index;
+
+        while (true)
+        {
+            if (run_one())
+                continue;
+
+            std::unique_lock lock{ m_sleep_mutex };
+            m_wake.wait(lock, [this]() { return m_stopping.load() || m_queued.load() > 0; });
+
+            if (m_stopping.load() && m_queued.load() == 0)
+                return;
+        }
+    }
+
+public:
+    /// workers can be 0, then the thread that waits does all the work
+    explicit ThreadPool(std::size_t workers)
+    {
+        /// one queue per worker, plus one for threads outside the pool
+        for (std::size_t i{ 0 }; i <= workers; ++i)
+            m_queues.push_back(std::make_unique<WorkQueue>());
+
+        for (std::size_t i{ 0 }; i < workers; ++i)
+            m_workers.emplace_back([this, i]() { work(i); });
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            const std::lock_guard lock{ m_sleep_mutex };
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+
+        for (std::thread& worker : m_workers)
+            worker.join();
+    }
+
+    /// the pool shared by parallel_repeat, one worker per core besides the calling thread
+    static ThreadPool& instance()
+    {
+        static ThreadPool s_pool{ std::max(1u, std::thread::hardware_concurrency()) - 1 };
+        return s_pool;
+    }
+
+    /// threads that can work at the same time: the workers and the thread waiting for them
+    std::size_t thread_count() const { return m_workers.size() + 1; }
+
+    /// 0 to workers - 1 inside a worker, workers for any thread outside the pool
+    std::size_t current_slot() const { return s_current_pool == this ? s_worker_index : m_workers.size(); }
+
+    /// adds task to group and queues it, from a worker it goes to that worker's own deque
+    void submit(TaskGroup& group, Task task)
+    {
+        group.m_pending.fetch_add(1);
+
+        const std::size_t slot{ current_slot() };
+        const std::size_t queue{ slot < m_workers.size() ? slot : m_next_queue.fetch_add(1) % m_queues.size() };
+
+        {
+            /// counted before it's queued, so the count never drops below 0 when it's taken right away
+            /// taking the lock makes sure a worker that just found nothing hasn't yet gone to sleep
+            const std::lock_guard lock{ m_sleep_mutex };
+            m_queued.fetch_add(1);
+        }
+
+        {
+            WorkQueue& work{ *m_queues[queue] };
+            const std::lock_guard lock{ work.mutex };
+            work.tasks.push_back(std::move(task));
+        }
+
+        m_wake.notify_one();
+    }
+
+    /// called by a task of group when it's done
+    static void finish(TaskGroup& group) { group.m_pending.fetch_sub(1); }
+
+    /// runs tasks until every task of group is done, then rethrows the first exception one threw
+    void wait(TaskGroup& group)
+    {
+        while (group.m_pending.load() > 0)
+        {
+            if (!run_one())
+                std::this_thread::yield();
+        }
+
+        if (group.m_error)
+            std::rethrow_exception(group.m_error);
+    }
+};
+
+namespace Parallel
+{
+    namespace detail
+    {
+        /// splits [begin, end) in halves, queueing the right half, until the piece is at most grain
+        /// long, then runs the left piece here; a stolen half splits again on the thief, so pieces
+        /// get smaller only where there are idle threads to take them
+        template <class Body>
+        void run_range(ThreadPool& pool, ThreadPool::TaskGroup& group, std::int64_t begin, std::int64_t end, std::int64_t grain, Body& body)
+        {
+            while (end - begin > grain)
+            {
+                const std::int64_t middle{ begin + (end - begin) / 2 };
+
+                pool.submit(group, [&pool, &group, middle, end, grain, &body]() {
+                    run_range(pool, group, middle, end, grain, body);
+                    ThreadPool::finish(group);
+                });
+
+                end = middle;
+            }
+
+            try
+            {
+                body(begin, end);
+            }
+            catch (...)
+            {
+                group.fail(std::current_exception());
+            }
+        }
+
+        /// about 8 pieces per thread when grain isn't given, enough to even out uneven iterations
+        inline std::int64_t pick_grain(const ThreadPool& pool, std::int64_t count, std::int64_t grain)
+        {
+            if (grain > 0)
+                return grain;
+
+            return std::max<std::int64_t>(1, count / static_cast<std::int64_t>(8 * pool.thread_count()));
+        }
+
+        template <class Body>
+        void run(ThreadPool& pool, std::int64_t count, std::int64_t grain, Body& body)
+        {
+            if (count <= 0)
+                return;
+
+            ThreadPool::TaskGroup group{};
+            run_range(pool, group, 0, count, pick_grain(pool, count, grain), body);
+            pool.wait(group);
+        }
+
+        /// one partial per thread, each on its own cache line so threads don't slow each other down
+        template <class T>
+        struct alignas(64) Partial
+        {
+            T value;
+        };
+    }
+
+    /// calls fn(i) for i from 0 to repetitions - 1 like repeat(), spread over the threads of the pool
+    /// the calls can happen in any order and at the same time, so fn must not depend on other
+    /// iterations; grain is the smallest number of iterations a thread takes at once (0 picks one)
+    template <class Function>
+    void parallel_repeat(int repetitions, Function&& fn, int grain = 0, ThreadPool& pool = ThreadPool::instance())
+    {
+        auto body{ [&fn](std::int64_t begin, std::int64_t end) {
+            for (std::int64_t i{ begin }; i < end; ++i)
+                fn(static_cast<int>(i));
+        } };
+
+        detail::run(pool, repetitions, grain, body);
+    }
+
+    /// combine(... combine(combine(identity, map(0)), map(1)) ..., map(repetitions - 1)) computed in
+    /// parallel: every thread combines into its own partial, and the partials are combined at the end
+    /// combine must be associative and commutative; for floating point the grouping changes from run
+    /// to run, so the last digits can too
+    template <class T, class Map, class Combine>
+    T parallel_reduce(int repetitions, T identity, Map&& map, Combine&& combine, int grain = 0, ThreadPool& pool = ThreadPool::instance())
+    {
+        std::vector<detail::Partial<T>> partials(pool.thread_count(), detail::Partial<T>{ identity });
+
+        /// threads outside the pool share the last partial, another one may be helping while it waits
+        const std::size_t outside{ pool.thread_count() - 1 };
+        std::mutex outside_mutex{};
+
+        auto body{ [&](std::int64_t begin, std::int64_t end) {
+            T local{ identity };
+            for (std::int64_t i{ begin }; i < end; ++i)
+                local = combine(std::move(local), map(static_cast<int>(i)));
+
+            const std::size_t slot{ pool.current_slot() };
+            std::unique_lock lock{ outside_mutex, std::defer_lock };
+            if (slot == outside)
+                lock.lock();
+
+            T& partial{ partials[slot].value };
+            partial = combine(std::move(partial), std::move(local));
+        } };
+
+        detail::run(pool, repetitions, grain, body);
+
+        T result{ std::move(identity) };
+        for (detail::Partial<T>& partial : partials)
+            result = combine(std::move(result), std::move(partial.value));
+
+        return result;
+    }
+}
+
+#endif /* ThreadPool_h */
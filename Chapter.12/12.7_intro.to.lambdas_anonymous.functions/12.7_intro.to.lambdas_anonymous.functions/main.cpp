@@ -161,6 +161,10 @@
 #include <string_view>
 #include <functional>
 #include <string>
+#include "Callable.h"
+#include "CallableBenchmark.h"
+#include "ThreadPool.h"
+#include <vector>
 
 /// passing a lambda to a function as a parameter
 /// the caller determines what lambda will be passed in
@@ -168,7 +172,18 @@
 ///
 /// if we had used auto for the type of fn
 /// the caller wouldn't know what parameters and return type fn needs to have
-void repeat(int repetitions, const std::function<void(int)>& fn)
+//void repeat(int repetitions, const std::function<void(int)>& fn)
+//{
+//    for (int i{ 0 }; i < repetitions; ++i)
+//    {
+//        fn(i);
+//    }
+//}
+
+/// FunctionRef instead of std::function : repeat only calls fn, it never keeps it
+/// so there's no need to copy the lambda (or allocate for it), a reference is enough
+/// run with --benchmark to compare std::function, FunctionRef, InplaceFunction and templates
+void repeat(int repetitions, FunctionRef<void(int)> fn)
 {
     for (int i{ 0 }; i < repetitions; ++i)
     {
@@ -193,8 +208,14 @@ struct Season
   double averageTemperature{};
 };
 
-int main()
+int main(int argc, char* argv[])
 {
+    if (argc > 1 && std::string_view{ argv[1] } == "--benchmark")
+    {
+        CallableBenchmark::print_table(CallableBenchmark::run());
+        return 0;
+    }
+    
     /// a trivial lambda definition looks like this
     /// lambda : with omitted return type, omitted parameters and no captures
     [] {};
@@ -262,6 +283,30 @@ int main()
          std::cout << i + 1 << '\n';
      });
     
+    /// FunctionRef also refers to plain functions
+    FunctionRef<bool(int, int)> compare{ greater };
+    std::cout << std::boolalpha << compare(3, 2) << std::noboolalpha << '\n';
+    
+    /// InplaceFunction keeps its own copy of the lambda, like std::function, but never on the heap
+    std::string greeting{ "hello" };
+    InplaceFunction<void(int)> greet{ [greeting](int i) { std::cout << greeting << ' ' << i << '\n'; } };
+    repeat(2, greet);
+    
+    /// parallel_repeat : like repeat, but the calls are shared between the threads of a pool
+    /// every i writes its own element, so the calls don't interfere with each other
+    std::vector<int> squares(10);
+    Parallel::parallel_repeat(static_cast<int>(squares.size()), [&squares](int i) { squares[static_cast<std::size_t>(i)] = i * i; });
+    
+    for (int square : squares)
+        std::cout << square << ' ';
+    std::cout << '\n';
+    
+    /// parallel_reduce : each thread adds up its own part, the parts are added at the end
+    long long sum_of_squares{ Parallel::parallel_reduce(1'000'000, 0LL,
+                                                        [](int i) { return static_cast<long long>(i) * i; },
+                                                        [](long long a, long long b) { return a + b; }) };
+    std::cout << sum_of_squares << '\n';
+    
     
     constexpr std::array months
     {
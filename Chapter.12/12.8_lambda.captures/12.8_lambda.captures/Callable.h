@@ -0,0 +1,190 @@
+//
+//  Callable.h
+//  12.8_lambda.captures
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef Callable_h
+#define Callable_h
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/// Two lighter alternatives to std::function for passing lambdas around
+///
+/// std::function owns a copy of the lambda, and when the captures don't fit in its small buffer
+/// (16 to 24 bytes depending on the standard library) the copy goes on the heap
+///
+/// FunctionRef<void(int)> doesn't own anything, it is a pointer to the lambda plus a pointer to a
+/// function that calls it: two pointers, never allocates, made for parameters like repeat(fn)
+/// the lambda must outlive the FunctionRef, so don't store one that refers to a temporary
+///
+/// InplaceFunction<void(int), 64> owns a copy like std::function, but always keeps it inside
+/// its own 64 bytes; a lambda with bigger captures doesn't compile instead of allocating
+template <class Signature>
+class FunctionRef;
+
+template <class R, class... Args>
+class FunctionRef<R(Args...)>
+{
+private:
+    /// a lambda is reached through an object pointer, a plain function through a function pointer
+    union Target
+    {
+        void* object;
+        void (*function)();
+    };
+
+    Target m_target{ nullptr };
+    R (*m_call)(Target, Args...){ nullptr };
+
+public:
+    template <class F,
+              std::enable_if_t<!std::is_same_v<std::remove_cv_t<std::remove_reference_t<F>>, FunctionRef>
+                               && std::is_invocable_r_v<R, F&, Args...>, int> = 0>
+    FunctionRef(F&& function) noexcept
+    {
+        using Stored = std::remove_reference_t<F>;
+
+        if constexpr (std::is_function_v<Stored>)
+        {
+            m_target.function = reinterpret_cast<void (*)()>(&function);
+            m_call = [](Target target, Args... args) -> R {
+                return std::invoke(reinterpret_cast<Stored*>(target.function), std::forward<Args>(args)...);
+            };
+        }
+        else
+        {
+            m_target.object = const_cast<void*>(static_cast<const void*>(std::addressof(function)));
+            m_call = [](Target target, Args... args) -> R {
+                return std::invoke(*static_cast<Stored*>(target.object), std::forward<Args>(args)...);
+            };
+        }
+    }
+
+    R operator()(Args... args) const { return m_call(m_target, std::forward<Args>(args)...); }
+};
+
+template <class Signature, std::size_t Capacity = 32>
+class InplaceFunction;
+
+template <class R, class... Args, std::size_t Capacity>
+class InplaceFunction<R(Args...), Capacity>
+{
+private:
+    /// what the stored lambda needs, one table per lambda type
+    struct Operations
+    {
+        R (*call)(void* object, Args... args);
+        void (*copy)(void* to, const void* from);
+        void (*move)(void* to, void* from);
+        void (*destroy)(void* object);
+    };
+
+    template <class F>
+    struct Model
+    {
+        static R call(void* object, Args... args) { return std::invoke(*static_cast<F*>(object), std::forward<Args>(args)...); }
+        static void copy(void* to, const void* from) { ::new (to) F(*static_cast<const F*>(from)); }
+        static void move(void* to, void* from) { ::new (to) F(std::move(*static_cast<F*>(from))); }
+        static void destroy(void* object) { static_cast<F*>(object)->~F(); }
+
+        static constexpr Operations s_operations{ &call, &copy, &move, &destroy };
+    };
+
+    alignas(std::max_align_t) mutable unsigned char m_storage[Capacity];
+    const Operations* m_operations{ nullptr };
+
+public:
+    InplaceFunction() noexcept = default;
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    template <class F,
+              class Stored = std::decay_t<F>,
+              std::enable_if_t<!std::is_same_v<Stored, InplaceFunction> && std::is_invocable_r_v<R, Stored&, Args...>, int> = 0>
+    InplaceFunction(F&& function)
+    {
+        static_assert(sizeof(Stored) <= Capacity, "the lambda's captures don't fit, use a bigger InplaceFunction");
+        static_assert(alignof(Stored) <= alignof(std::max_align_t), "the lambda needs a stricter alignment than InplaceFunction has");
+        static_assert(std::is_copy_constructible_v<Stored>, "InplaceFunction copies like std::function, the lambda must be copyable");
+        static_assert(std::is_nothrow_move_constructible_v<Stored>, "moving an InplaceFunction never throws, neither may moving the lambda");
+
+        ::new (static_cast<void*>(m_storage)) Stored(std::forward<F>(function));
+        m_operations = &Model<Stored>::s_operations;
+    }
+
+    InplaceFunction(const InplaceFunction& other)
+        : m_operations{ other.m_operations }
+    {
+        if (m_operations)
+            m_operations->copy(m_storage, other.m_storage);
+    }
+
+    /// other is empty afterwards
+    InplaceFunction(InplaceFunction&& other) noexcept
+        : m_operations{ other.m_operations }
+    {
+        if (m_operations)
+        {
+            m_operations->move(m_storage, other.m_storage);
+            other.reset();
+        }
+    }
+
+    InplaceFunction& operator=(const InplaceFunction& other)
+    {
+        if (this != &other)
+        {
+            InplaceFunction copy{ other };
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+
+            if (other.m_operations)
+            {
+                other.m_operations->move(m_storage, other.m_storage);
+                m_operations = other.m_operations;
+                other.reset();
+            }
+        }
+
+        return *this;
+    }
+
+    ~InplaceFunction() { reset(); }
+
+    void reset() noexcept
+    {
+        if (m_operations)
+        {
+            m_operations->destroy(m_storage);
+            m_operations = nullptr;
+        }
+    }
+
+    explicit operator bool() const noexcept { return m_operations != nullptr; }
+
+    /// like std::function, calling a mutable lambda changes the stored copy even through a const
+    /// InplaceFunction
+    R operator()(Args... args) const
+    {
+        assert(m_operations && "calling an empty InplaceFunction");
+        return m_operations->call(m_storage, std::forward<Args>(args)...);
+    }
+};
+
+#endif /* Callable_h */
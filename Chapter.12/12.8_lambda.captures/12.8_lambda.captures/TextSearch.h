@@ -0,0 +1,362 @@
+//
+//  TextSearch.h
+//  12.8_lambda.captures
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef TextSearch_h
+#define TextSearch_h
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/// Substring search over many strings at once
+///
+/// std::find_if with str.find(search) reads every string for every search
+/// SuffixIndex sorts all the suffixes of all the strings once, after that a search is a binary
+/// search: about log2(total characters) comparisons, however many strings there are
+///
+/// AhoCorasick goes the other way: many search terms, and one pass over a text finds all of them
+namespace TextSearch
+{
+    class SuffixIndex
+    {
+    private:
+        /// every string followed by '\0', so a match can't run from one string into the next
+        std::string m_text{};
+        /// where each string starts in m_text
+        std::vector<std::uint32_t> m_starts{};
+        /// positions in m_text, sorted by the suffix starting there
+        std::vector<std::uint32_t> m_suffixes{};
+
+        static constexpr char s_separator{ '\0' };
+
+        /// prefix doubling: sorted by the first 1, 2, 4, 8, ... characters, each round is two
+        /// counting sorts, until every suffix has its own rank
+        void build_suffixes()
+        {
+            const std::size_t n{ m_text.size() };
+            m_suffixes.resize(n);
+            if (n == 0)
+                return;
+
+            std::vector<std::uint32_t> rank(n);
+            std::vector<std::uint32_t> next_rank(n);
+            std::vector<std::uint32_t> by_second(n);
+            std::vector<std::uint32_t> count(std::max<std::size_t>(n, 256) + 1);
+
+            /// first round: the first character
+            for (std::size_t i{ 0 }; i < n; ++i)
+                ++count[static_cast<unsigned char>(m_text[i]) + 1];
+            for (std::size_t c{ 1 }; c <= 256; ++c)
+                count[c] += count[c - 1];
+            for (std::size_t i{ 0 }; i < n; ++i)
+                m_suffixes[count[static_cast<unsigned char>(m_text[i])]++] = static_cast<std::uint32_t>(i);
+
+            std::uint32_t classes{ 1 };
+            rank[m_suffixes[0]] = 0;
+            for (std::size_t i{ 1 }; i < n; ++i)
+            {
+                if (m_text[m_suffixes[i]] != m_text[m_suffixes[i - 1]])
+                    ++classes;
+                rank[m_suffixes[i]] = classes - 1;
+            }
+
+            for (std::size_t k{ 1 }; classes < n; k *= 2)
+            {
+                /// ordered by the second half: suffixes shorter than k have an empty second half and
+                /// come first, the others follow the current order shifted by k
+                std::size_t filled{ 0 };
+                for (std::size_t i{ n - k }; i < n; ++i)
+                    by_second[filled++] = static_cast<std::uint32_t>(i);
+                for (std::size_t i{ 0 }; i < n; ++i)
+                    if (m_suffixes[i] >= k)
+                        by_second[filled++] = static_cast<std::uint32_t>(m_suffixes[i] - k);
+
+                /// stable counting sort by the first half
+                std::fill(count.begin(), count.begin() + classes + 1, 0);
+                for (std::size_t i{ 0 }; i < n; ++i)
+                    ++count[rank[i] + 1];
+                for (std::size_t c{ 1 }; c <= classes; ++c)
+                    count[c] += count[c - 1];
+                for (std::size_t i{ 0 }; i < n; ++i)
+                    m_suffixes[count[rank[by_second[i]]]++] = by_second[i];
+
+                auto second{ [&rank, n, k](std::size_t i) { return i + k < n ? static_cast<std::int64_t>(rank[i + k]) : -1; } };
+
+                classes = 1;
+                next_rank[m_suffixes[0]] = 0;
+                for (std::size_t i{ 1 }; i < n; ++i)
+                {
+                    const std::uint32_t a{ m_suffixes[i - 1] };
+                    const std::uint32_t b{ m_suffixes[i] };
+                    if (rank[a] != rank[b] || second(a) != second(b))
+                        ++classes;
+                    next_rank[b] = classes - 1;
+                }
+
+                rank.swap(next_rank);
+            }
+        }
+
+        /// which string the text position belongs to
+        std::size_t owner(std::uint32_t position) const
+        {
+            return static_cast<std::size_t>(std::upper_bound(m_starts.begin(), m_starts.end(), position) - m_starts.begin()) - 1;
+        }
+
+        /// the range of m_suffixes that start with pattern
+        std::pair<std::size_t, std::size_t> range(std::string_view pattern) const
+        {
+            if (pattern.empty() || pattern.find(s_separator) != std::string_view::npos)
+                return { 0, 0 };
+
+            auto prefix{ [this, &pattern](std::uint32_t position) {
+                return std::string_view{ m_text }.substr(position, pattern.size());
+            } };
+
+            const auto first{ std::lower_bound(m_suffixes.begin(), m_suffixes.end(), pattern,
+                                               [&prefix](std::uint32_t position, std::string_view p) { return prefix(position) < p; }) };
+            const auto last{ std::upper_bound(first, m_suffixes.end(), pattern,
+                                              [&prefix](std::string_view p, std::uint32_t position) { return p < prefix(position); }) };
+
+            return { static_cast<std::size_t>(first - m_suffixes.begin()), static_cast<std::size_t>(last - m_suffixes.begin()) };
+        }
+
+    public:
+        SuffixIndex() = default;
+
+        /// copies the strings, so they don't have to outlive the index
+        /// strings must not contain '\0', and all together must be shorter than 4 GB
+        template <class Collection>
+        explicit SuffixIndex(const Collection& strings)
+        {
+            for (const auto& string : strings)
+            {
+                const std::string_view view{ string };
+                m_starts.push_back(static_cast<std::uint32_t>(m_text.size()));
+                m_text.append(view);
+                m_text.push_back(s_separator);
+            }
+
+            build_suffixes();
+        }
+
+        std::size_t size() const { return m_starts.size(); }
+
+        std::string_view operator[](std::size_t index) const
+        {
+            const std::size_t end{ index + 1 < m_starts.size() ? m_starts[index + 1] : m_text.size() };
+            return std::string_view{ m_text }.substr(m_starts[index], end - m_starts[index] - 1);
+        }
+
+        /// number of places pattern occurs, in all strings together
+        std::size_t count(std::string_view pattern) const
+        {
+            const auto [first, last]{ range(pattern) };
+            return last - first;
+        }
+
+        /// index of the first string that contains pattern, or size() if none does
+        /// the same string std::find_if with str.find(pattern) would find
+        std::size_t find_first(std::string_view pattern) const
+        {
+            const auto [first, last]{ range(pattern) };
+
+            std::size_t best{ size() };
+            for (std::size_t i{ first }; i < last; ++i)
+                best = std::min(best, owner(m_suffixes[i]));
+
+            return best;
+        }
+
+        /// indexes of every string that contains pattern, in order, each once
+        std::vector<std::size_t> find_all(std::string_view pattern) const
+        {
+            const auto [first, last]{ range(pattern) };
+
+            std::vector<std::size_t> found{};
+            found.reserve(last - first);
+            for (std::size_t i{ first }; i < last; ++i)
+                found.push_back(owner(m_suffixes[i]));
+
+            std::sort(found.begin(), found.end());
+            found.erase(std::unique(found.begin(), found.end()), found.end());
+
+            return found;
+        }
+    };
+
+    /// Finds every occurrence of many search terms in one pass over a text (Aho and Corasick, 1975)
+    ///
+    /// the terms are put in a trie, and every node knows where to continue when the next character
+    /// doesn't match, so the text is read once, one table lookup per character
+    /// only the characters used in the terms get their own column in the table, every other
+    /// character shares column 0, which keeps the table small
+    class AhoCorasick
+    {
+    public:
+        struct Match
+        {
+            std::size_t term{};         /// index of the search term
+            std::size_t position{};     /// where it starts in the text
+        };
+
+    private:
+        static constexpr std::uint32_t s_none{ 0xFFFFFFFF };
+
+        std::array<std::uint16_t, 256> m_column{};
+        std::size_t m_columns{ 1 };
+        /// m_next[state * m_columns + column] is the state after reading a character
+        std::vector<std::uint32_t> m_next{};
+        /// first term ending at a state, and the next term with the same text
+        std::vector<std::uint32_t> m_term_at{};
+        std::vector<std::uint32_t> m_same_term{};
+        /// nearest shorter state (by the suffix links) where a term ends
+        std::vector<std::uint32_t> m_output_link{};
+        std::vector<std::size_t> m_lengths{};
+
+        std::uint32_t add_state()
+        {
+            m_next.resize(m_next.size() + m_columns, s_none);
+            m_term_at.push_back(s_none);
+            m_output_link.push_back(s_none);
+            return static_cast<std::uint32_t>(m_term_at.size() - 1);
+        }
+
+        std::size_t column(char c) const { return m_column[static_cast<unsigned char>(c)]; }
+
+    public:
+        template <class Collection>
+        explicit AhoCorasick(const Collection& terms)
+        {
+            for (const auto& term : terms)
+                for (char c : std::string_view{ term })
+                    if (m_column[static_cast<unsigned char>(c)] == 0)
+                        m_column[static_cast<unsigned char>(c)] = static_cast<std::uint16_t>(m_columns++);
+
+            add_state();
+
+            /// the trie
+            for (const auto& term : terms)
+            {
+                const std::string_view text{ term };
+                std::uint32_t state{ 0 };
+
+                for (char c : text)
+                {
+                    const std::size_t slot{ state * m_columns + column(c) };
+                    if (m_next[slot] == s_none)
+                    {
+                        /// add_state grows m_next, so no reference into it is kept across the call
+                        const std::uint32_t created{ add_state() };
+                        m_next[slot] = created;
+                    }
+                    state = m_next[slot];
+                }
+
+                /// an empty term keeps its index but never matches
+                const std::uint32_t index{ static_cast<std::uint32_t>(m_lengths.size()) };
+                m_lengths.push_back(text.size());
+                m_same_term.push_back(s_none);
+
+                if (!text.empty())
+                {
+                    m_same_term[index] = m_term_at[state];
+                    m_term_at[state] = index;
+                }
+            }
+
+            /// breadth first, the fail state of a node is always closer to the root, so it is finished
+            /// before the node needs it; missing transitions are filled in from the fail state
+            std::vector<std::uint32_t> fail(m_term_at.size(), 0);
+            std::queue<std::uint32_t> pending{};
+
+            for (std::size_t c{ 0 }; c < m_columns; ++c)
+            {
+                std::uint32_t& next{ m_next[c] };
+                if (next == s_none)
+                    next = 0;
+                else
+                    pending.push(next);
+            }
+
+            while (!pending.empty())
+            {
+                const std::uint32_t state{ pending.front() };
+                pending.pop();
+
+                const std::uint32_t link{ fail[state] };
+                m_output_link[state] = m_term_at[link] != s_none ? link : m_output_link[link];
+
+                for (std::size_t c{ 0 }; c < m_columns; ++c)
+                {
+                    std::uint32_t& next{ m_next[state * m_columns + c] };
+                    if (next == s_none)
+                    {
+                        next = m_next[link * m_columns + c];
+                    }
+                    else
+                    {
+                        fail[next] = m_next[link * m_columns + c];
+                        pending.push(next);
+                    }
+                }
+            }
+        }
+
+        std::size_t term_count() const { return m_lengths.size(); }
+
+        /// calls found(Match) for every occurrence of every term, in the order they end in text
+        template <class Found>
+        void for_each_match(std::string_view text, Found&& found) const
+        {
+            std::uint32_t state{ 0 };
+
+            for (std::size_t i{ 0 }; i < text.size(); ++i)
+            {
+                state = m_next[state * m_columns + column(text[i])];
+
+                for (std::uint32_t output{ m_term_at[state] != s_none ? state : m_output_link[state] };
+                     output != s_none; output = m_output_link[output])
+                {
+                    for (std::uint32_t term{ m_term_at[output] }; term != s_none; term = m_same_term[term])
+                        found(Match{ term, i + 1 - m_lengths[term] });
+                }
+            }
+        }
+
+        std::vector<Match> matches(std::string_view text) const
+        {
+            std::vector<Match> found{};
+            for_each_match(text, [&found](const Match& match) { found.push_back(match); });
+
+            return found;
+        }
+
+        /// true if any term occurs in text, stops at the first one
+        bool contains_any(std::string_view text) const
+        {
+            std::uint32_t state{ 0 };
+
+            for (char c : text)
+            {
+                state = m_next[state * m_columns + column(c)];
+                if (m_term_at[state] != s_none || m_output_link[state] != s_none)
+                    return true;
+            }
+
+            return false;
+        }
+    };
+}
+
+#endif /* TextSearch_h */
@@ -175,6 +175,8 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include "Callable.h"
+#include "TextSearch.h"
 
 struct Car
 {
@@ -194,6 +196,14 @@ void my_invoke(const std::function<void()>& func)
     func();
 }
 
+/// FunctionRef - refers to the lambda object passed, no copy is made
+/// works like passing std::ref(lambda) to my_invoke, without the std::function around it
+void my_invoke_ref(FunctionRef<void()> func)
+{
+    /// func is executed on the actual lambda object
+    func();
+}
+
 int main()
 {
     std::array<std::string_view, 4> A{ "apple", "banana", "walnut", "lemon" };
@@ -220,6 +230,26 @@ int main()
     else
         std::cout << "Found " << *found << '\n';
     
+    /// the same search with an index built once over all the strings
+    /// every later search is a binary search instead of a find in every string
+    const TextSearch::SuffixIndex index{ A };
+    
+    if (std::size_t first{ index.find_first(search) }; first == index.size())
+        std::cout << "Not found!\n";
+    else
+        std::cout << "Found " << index[first] << " (index)\n";
+    
+    /// several search terms at once, each string is read only one time
+    constexpr std::array<std::string_view, 3> terms{ "an", "nut", "le" };
+    const TextSearch::AhoCorasick automaton{ terms };
+    
+    for (std::string_view str : A)
+    {
+        automaton.for_each_match(str, [&str, &terms](const TextSearch::AhoCorasick::Match& match) {
+            std::cout << terms[match.term] << " in " << str << " at " << match.position << '\n';
+        });
+    }
+    
     
     int ammo{ 10 };
     
@@ -491,5 +521,28 @@ int main()
     my_invoke(std::ref(count_invoke_ref));
     my_invoke(std::ref(count_invoke_ref));
     
+    int m{ 0 };
+    
+    auto count_invoke_function_ref
+    {
+        [m]() mutable
+        {
+            std::cout << "FunctionRef : " << ++m << '\n';
+        }
+    };
+    
+    /// the same lambda object is called every time, m keeps counting
+    my_invoke_ref(count_invoke_function_ref);
+    my_invoke_ref(count_invoke_function_ref);
+    my_invoke_ref(count_invoke_function_ref);
+    
+    /// InplaceFunction - makes its own copy of the lambda like std::function
+    /// but the copy lives inside the InplaceFunction object, never on the heap
+    InplaceFunction<void()> stored_count{ count_invoke_function_ref };
+    stored_count();
+    stored_count();
+    /// the original lambda was not changed by the calls on the copy
+    count_invoke_function_ref();
+    
     return 0;
 }
@@ -273,40 +273,44 @@ public:
     {
     }
 
-    void print() const
+    char rank_symbol() const
     {
         switch (m_rank)
         {
-        case rank_2:        std::cout << '2';   break;
-        case rank_3:        std::cout << '3';   break;
-        case rank_4:        std::cout << '4';   break;
-        case rank_5:        std::cout << '5';   break;
-        case rank_6:        std::cout << '6';   break;
-        case rank_7:        std::cout << '7';   break;
-        case rank_8:        std::cout << '8';   break;
-        case rank_9:        std::cout << '9';   break;
-        case rank_10:       std::cout << 'T';   break;
-        case rank_jack:     std::cout << 'J';   break;
-        case rank_queen:    std::cout << 'Q';   break;
-        case rank_king:     std::cout << 'K';   break;
-        case rank_ace:      std::cout << 'A';   break;
-        default:
-            std::cout << '?';
-            break;
+        case rank_2:        return '2';
+        case rank_3:        return '3';
+        case rank_4:        return '4';
+        case rank_5:        return '5';
+        case rank_6:        return '6';
+        case rank_7:        return '7';
+        case rank_8:        return '8';
+        case rank_9:        return '9';
+        case rank_10:       return 'T';
+        case rank_jack:     return 'J';
+        case rank_queen:    return 'Q';
+        case rank_king:     return 'K';
+        case rank_ace:      return 'A';
+        default:            return '?';
         }
+    }
 
+    char suit_symbol() const
+    {
         switch (m_suit)
         {
-        case club:          std::cout << 'C';   break;
-        case diamond:       std::cout << 'D';   break;
-        case heart:         std::cout << 'H';   break;
-        case spade:         std::cout << 'S';   break;
-        default:
-            std::cout << '?';
-            break;
+        case club:          return 'C';
+        case diamond:       return 'D';
+        case heart:         return 'H';
+        case spade:         return 'S';
+        default:            return '?';
         }
     }
 
+    void print() const
+    {
+        std::cout << rank_symbol() << suit_symbol();
+    }
+
     int value() const
     {
         switch (m_rank)
@@ -356,15 +360,22 @@ public:
         }
     }
 
+    /// the whole deck is composed into one line first and handed to std::cout at once,
+    /// instead of streaming it a card at a time
     void print() const
     {
+        std::array<char, 52 * 3 + 1> line{};
+        std::size_t length{ 0 };
+
         for (const auto& card : m_deck)
         {
-            card.print();
-            std::cout << ' ';
+            line[length++] = card.rank_symbol();
+            line[length++] = card.suit_symbol();
+            line[length++] = ' ';
         }
 
-        std::cout << '\n';
+        line[length++] = '\n';
+        std::cout.write(line.data(), static_cast<std::streamsize>(length));
     }
 
     void shuffle()
@@ -0,0 +1,181 @@
+//
+//  SharedString.h
+//  14.16_shallow.vs.deep.copying
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef SharedString_h
+#define SharedString_h
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <utility>
+
+/// A string that is copied shallow and only deep copied when it has to be (copy-on-write)
+///
+/// the characters live in one buffer together with a count of the strings using it
+/// - copying a SharedString copies the pointer and adds 1 to the count, like the shallow copy,
+///   but the buffer is only deleted when the count drops to 0, so there's no dangling pointer
+/// - changing a string whose buffer is shared first gives it its own copy (detach), so the other
+///   strings never see the change
+/// - moving hands the buffer over, nothing is counted or copied
+/// the count is atomic, so copies of one string can be used and destroyed on different threads
+class SharedString
+{
+private:
+    struct Buffer
+    {
+        std::atomic<int> references{ 1 };
+        int length{};           /// including the null terminator, like MyString::m_length
+
+        /// the characters are stored right after the Buffer, in the same allocation
+        char* data() { return reinterpret_cast<char*>(this + 1); }
+    };
+
+    /// nullptr is the empty string, so an empty or moved-from string owns nothing
+    Buffer* m_buffer{ nullptr };
+
+    static Buffer* allocate(int length)
+    {
+        void* memory{ ::operator new(sizeof(Buffer) + static_cast<std::size_t>(length)) };
+        Buffer* buffer{ ::new (memory) Buffer{} };
+        buffer->length = length;
+
+        return buffer;
+    }
+
+    static Buffer* make(const char* source, int length)
+    {
+        Buffer* buffer{ allocate(length) };
+        std::memcpy(buffer->data(), source, static_cast<std::size_t>(length));
+
+        return buffer;
+    }
+
+    void release() noexcept
+    {
+        if (m_buffer && m_buffer->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            m_buffer->~Buffer();
+            ::operator delete(m_buffer);
+        }
+
+        m_buffer = nullptr;
+    }
+
+    /// makes sure this string is the only one using its buffer, the deep copy happens here
+    void detach()
+    {
+        if (!m_buffer || use_count() == 1)
+            return;
+
+        Buffer* buffer{ make(m_buffer->data(), m_buffer->length) };
+        release();
+        m_buffer = buffer;
+    }
+
+public:
+    SharedString() noexcept = default;
+
+    SharedString(const char* source)
+    {
+        assert(source);
+
+        const int length{ static_cast<int>(std::strlen(source)) + 1 };
+        if (length > 1)
+            m_buffer = make(source, length);
+    }
+
+    SharedString(const SharedString& source) noexcept
+        : m_buffer{ source.m_buffer }
+    {
+        if (m_buffer)
+            m_buffer->references.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    SharedString(SharedString&& source) noexcept
+        : m_buffer{ std::exchange(source.m_buffer, nullptr) }
+    {
+    }
+
+    SharedString& operator=(const SharedString& source) noexcept
+    {
+        /// counting first makes self-assignment safe
+        Buffer* buffer{ source.m_buffer };
+        if (buffer)
+            buffer->references.fetch_add(1, std::memory_order_relaxed);
+
+        release();
+        m_buffer = buffer;
+
+        return *this;
+    }
+
+    SharedString& operator=(SharedString&& source) noexcept
+    {
+        if (&source != this)
+        {
+            release();
+            m_buffer = std::exchange(source.m_buffer, nullptr);
+        }
+
+        return *this;
+    }
+
+    ~SharedString() { release(); }
+
+    const char* get_string() const { return m_buffer ? m_buffer->data() : ""; }
+
+    /// including the null terminator, like MyString::get_length()
+    int get_length() const { return m_buffer ? m_buffer->length : 1; }
+
+    /// number of strings sharing this buffer, 0 for an empty string
+    int use_count() const { return m_buffer ? m_buffer->references.load(std::memory_order_acquire) : 0; }
+
+    bool shares_buffer_with(const SharedString& other) const { return m_buffer && m_buffer == other.m_buffer; }
+
+    char operator[](int index) const
+    {
+        assert(index >= 0 && index < get_length() - 1 && "index out of range");
+        return m_buffer->data()[index];
+    }
+
+    /// changing a character detaches first; there's no non-const operator[], a char& kept by the
+    /// caller would still point into the buffer after a later copy shares it
+    void set(int index, char c)
+    {
+        assert(index >= 0 && index < get_length() - 1 && "index out of range");
+
+        detach();
+        m_buffer->data()[index] = c;
+    }
+
+    SharedString& append(const char* source)
+    {
+        assert(source);
+
+        const int added{ static_cast<int>(std::strlen(source)) };
+        if (added == 0)
+            return *this;
+
+        /// always a new buffer, the length changes; the old one is released last, in case source
+        /// points into it
+        const int old_length{ get_length() };
+        Buffer* buffer{ allocate(old_length + added) };
+
+        if (m_buffer)
+            std::memcpy(buffer->data(), m_buffer->data(), static_cast<std::size_t>(old_length) - 1);
+        std::memcpy(buffer->data() + old_length - 1, source, static_cast<std::size_t>(added) + 1);
+
+        release();
+        m_buffer = buffer;
+
+        return *this;
+    }
+};
+
+#endif /* SharedString_h */
@@ -57,6 +57,8 @@
 #include <cstring>
 #include <cassert>
 #include <iostream>
+#include <utility>
+#include "SharedString.h"
 
 class MyString
 {
@@ -78,8 +80,10 @@ public:
         m_data = new char[m_length];
         
         /// copy the source into our internal buffer
-        for (int i{ 0 }; i < m_length; ++i)
-            m_data[i] = source[i];
+        /// std::memcpy copies the whole block at once instead of one char at a time
+        /*for (int i{ 0 }; i < m_length; ++i)
+            m_data[i] = source[i];*/
+        std::memcpy(m_data, source, static_cast<std::size_t>(m_length));
     }
     
     ~MyString()
@@ -102,6 +106,11 @@ public:
     MyString(const MyString& source);
     MyString& operator=(const MyString& source);
     
+    /// moving takes over the source's buffer, nothing is allocated or copied
+    /// the source is left as an empty string that owns nothing
+    MyString(MyString&& source) noexcept;
+    MyString& operator=(MyString&& source) noexcept;
+    
     void deepcopy(const MyString& source);
     
     char* get_string() { return m_data; }
@@ -123,8 +132,9 @@ void MyString::deepcopy(const MyString& source)
         m_data = new char[m_length];
         
         /// do the copy
-        for (int i{ 0 }; i < m_length; ++i)
-            m_data[i] = source.m_data[i];
+        /*for (int i{ 0 }; i < m_length; ++i)
+            m_data[i] = source.m_data[i];*/
+        std::memcpy(m_data, source.m_data, static_cast<std::size_t>(m_length));
     }
     else
         /// if the pointer is null then set the m_data to nullptr too
@@ -148,6 +158,25 @@ MyString& MyString::operator=(const MyString& source)
     return *this;
 }
 
+MyString::MyString(MyString&& source) noexcept
+    : m_data{ std::exchange(source.m_data, nullptr) }
+    , m_length{ std::exchange(source.m_length, 0) }
+{
+}
+
+MyString& MyString::operator=(MyString&& source) noexcept
+{
+    if (&source != this)
+    {
+        delete[] m_data;
+        
+        m_data = std::exchange(source.m_data, nullptr);
+        m_length = std::exchange(source.m_length, 0);
+    }
+    
+    return *this;
+}
+
 int main()
 {
     /// this calls MyString constructor,
@@ -180,5 +209,24 @@ int main()
     /// working now, because of the deep copy
     std::cout << hello.get_string() << '\n';
     
+    /// copy-on-write : copies share one buffer, it is deep copied only when one of them changes
+    SharedString shared{ "hello, world!" };
+    
+    {
+        /// no allocation, both strings use the same buffer, which now counts 2 users
+        SharedString copy_shared{ shared };
+        std::cout << copy_shared.get_string() << " (users: " << shared.use_count() << ")\n";
+        
+        /// changing the copy gives it its own buffer first, shared is not affected
+        copy_shared.set(0, 'H');
+        std::cout << copy_shared.get_string() << " / " << shared.get_string() << '\n';
+    }   /// copy_shared releases its own buffer, shared still has its buffer
+    
+    std::cout << shared.get_string() << " (users: " << shared.use_count() << ")\n";
+    
+    /// moving hands the buffer over, hello_moved now owns hello's buffer
+    MyString hello_moved{ std::move(hello) };
+    std::cout << hello_moved.get_string() << '\n';
+    
     return 0;
 }
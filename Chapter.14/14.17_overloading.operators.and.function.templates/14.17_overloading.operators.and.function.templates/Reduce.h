@@ -0,0 +1,452 @@
+//
+//  Reduce.h
+//  14.17_overloading.operators.and.function.templates
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef Reduce_h
+#define Reduce_h
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/// sum, average, min, max and variance of an array, a faster and safer version of average() in main.cpp
+/// - integers are added in a wider type, so the sum of many large ints doesn't overflow
+/// - floating point numbers are added with compensated (Kahan) summation, so the rounding error stays
+///   small even for billions of values
+/// - several independent accumulators are used, so the additions don't have to wait for each other and
+///   the compiler can turn the loops into vector instructions
+/// - large arrays are split between threads, every thread reduces its own part
+/// - any other type works too if it has the operators the original average() needs: T{ 0 }, += and /=
+///   (and < for min() and max())
+///
+/// Kahan summation depends on the exact order of floating point operations, don't build with -ffast-math
+namespace Reduce
+{
+    struct Options
+    {
+        unsigned int threads{ 0 };                  /// 0 - use every hardware thread
+        std::size_t min_per_thread{ 1 << 18 };      /// smaller parts are not worth starting a thread for
+    };
+
+    /// result of statistics(), the variance is computed without ever squaring the raw values, so it
+    /// doesn't lose precision when the values are large and close together
+    struct Statistics
+    {
+        std::uint64_t count{ 0 };
+        double mean{ 0.0 };
+        double m2{ 0.0 };           /// sum of squared differences from the mean
+        double min{ 0.0 };
+        double max{ 0.0 };
+
+        double variance() const { return count > 0 ? m2 / static_cast<double>(count) : 0.0; }
+        double sample_variance() const { return count > 1 ? m2 / static_cast<double>(count - 1) : 0.0; }
+
+        /// combines the statistics of two separate sets of values (Chan's formula)
+        void merge(const Statistics& other)
+        {
+            if (other.count == 0)
+                return;
+
+            if (count == 0)
+            {
+                *this = other;
+                return;
+            }
+
+            const double total{ static_cast<double>(count + other.count) };
+            const double delta{ other.mean - mean };
+
+            mean += delta * static_cast<double>(other.count) / total;
+            m2 += other.m2 + delta * delta * static_cast<double>(count) * static_cast<double>(other.count) / total;
+            min = std::min(min, other.min);
+            max = std::max(max, other.max);
+            count += other.count;
+        }
+    };
+
+    namespace detail
+    {
+#if defined(__SIZEOF_INT128__)
+        /// a compiler extension, __extension__ keeps -Wpedantic quiet about it
+        __extension__ using WideSigned = __int128;
+        __extension__ using WideUnsigned = unsigned __int128;
+#else
+        /// without 128-bit integers the sum of 64-bit values can still overflow
+        using WideSigned = std::int64_t;
+        using WideUnsigned = std::uint64_t;
+#endif
+
+        /// independent accumulators per loop, enough to fill two 256-bit vector registers
+        constexpr std::size_t s_lanes{ 8 };
+
+        /// statistics() works on blocks this size, small enough to stay in the cache for the second pass
+        constexpr std::size_t s_block_size{ 4096 };
+
+        /// a sum with its rounding error, the true sum is sum - compensation
+        template <typename A>
+        struct Compensated
+        {
+            A sum{ 0 };
+            A compensation{ 0 };
+
+            void add(A value)
+            {
+                const A corrected{ value - compensation };
+                const A next{ sum + corrected };
+                compensation = (next - sum) - corrected;
+                sum = next;
+            }
+
+            void merge(const Compensated& other)
+            {
+                add(other.sum);
+                add(-other.compensation);
+            }
+
+            A value() const { return sum - compensation; }
+        };
+
+        /// what the values of type T are added into
+        template <typename T>
+        using Total = std::conditional_t<std::is_integral_v<T>,
+                                         std::conditional_t<std::is_signed_v<T>, WideSigned, WideUnsigned>,
+                                         std::conditional_t<std::is_floating_point_v<T>,
+                                                            Compensated<std::conditional_t<std::is_same_v<T, float>, double, T>>,
+                                                            T>>;
+
+        /// calls part(first, last) for consecutive parts of [0, count), one thread per part, and combines
+        /// the results with merge(into, from) in order, so the result doesn't depend on thread timing
+        template <typename Partial, typename Part, typename Merge>
+        Partial parallel(std::size_t count, const Options& options, Part part, Merge merge)
+        {
+            unsigned int threads{ options.threads ? options.threads : std::thread::hardware_concurrency() };
+            const std::size_t useful{ count / std::max<std::size_t>(options.min_per_thread, 1) };
+            threads = static_cast<unsigned int>(std::max<std::size_t>(1, std::min<std::size_t>(threads, useful)));
+
+            if (threads == 1)
+                return part(0, count);
+
+            /// user types need not be default constructible
+            std::vector<std::optional<Partial>> partials(threads);
+            std::vector<std::thread> workers{};
+
+            for (unsigned int index{ 0 }; index < threads; ++index)
+            {
+                const std::size_t first{ count * index / threads };
+                const std::size_t last{ count * (index + 1) / threads };
+                workers.emplace_back([&partials, &part, index, first, last] { partials[index].emplace(part(first, last)); });
+            }
+
+            for (std::thread& worker : workers)
+                worker.join();
+
+            Partial result{ std::move(*partials[0]) };
+            for (unsigned int index{ 1 }; index < threads; ++index)
+                merge(result, *partials[index]);
+
+            return result;
+        }
+
+        template <typename T>
+        Total<T> sum_part(const T* data, std::size_t count)
+        {
+            if constexpr (std::is_integral_v<T> && sizeof(T) <= 4)
+            {
+                /// 64-bit lanes are faster than 128-bit ones and can't overflow within a block this size
+                using Lane = std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+                constexpr std::size_t block_size{ std::size_t{ 1 } << 24 };
+
+                Total<T> total{ 0 };
+
+                for (std::size_t first{ 0 }; first < count; first += block_size)
+                {
+                    const std::size_t last{ std::min(count, first + block_size) };
+                    Lane lanes[s_lanes]{};
+
+                    std::size_t i{ first };
+                    for (; i + s_lanes <= last; i += s_lanes)
+                        for (std::size_t lane{ 0 }; lane < s_lanes; ++lane)
+                            lanes[lane] += data[i + lane];
+
+                    for (; i < last; ++i)
+                        lanes[0] += data[i];
+
+                    for (Lane lane : lanes)
+                        total += lane;
+                }
+
+                return total;
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                Total<T> lanes[s_lanes]{};
+
+                std::size_t i{ 0 };
+                for (; i + s_lanes <= count; i += s_lanes)
+                    for (std::size_t lane{ 0 }; lane < s_lanes; ++lane)
+                        lanes[lane] += data[i + lane];
+
+                for (; i < count; ++i)
+                    lanes[0] += data[i];
+
+                Total<T> total{ 0 };
+                for (const Total<T>& lane : lanes)
+                    total += lane;
+
+                return total;
+            }
+            else if constexpr (std::is_floating_point_v<T>)
+            {
+                /// each lane is a separate Kahan sum, the lanes don't depend on each other, so the
+                /// compiler can vectorize them without changing the order of any lane's operations
+                using A = decltype(Total<T>::sum);
+                A sums[s_lanes]{};
+                A compensations[s_lanes]{};
+
+                std::size_t i{ 0 };
+                for (; i + s_lanes <= count; i += s_lanes)
+                {
+                    for (std::size_t lane{ 0 }; lane < s_lanes; ++lane)
+                    {
+                        const A corrected{ static_cast<A>(data[i + lane]) - compensations[lane] };
+                        const A next{ sums[lane] + corrected };
+                        compensations[lane] = (next - sums[lane]) - corrected;
+                        sums[lane] = next;
+                    }
+                }
+
+                Total<T> total{};
+                for (std::size_t lane{ 0 }; lane < s_lanes; ++lane)
+                    total.merge({ sums[lane], compensations[lane] });
+
+                for (; i < count; ++i)
+                    total.add(static_cast<A>(data[i]));
+
+                return total;
+            }
+            else
+            {
+                /// a user type, only += is known
+                T total{ 0 };
+                for (std::size_t i{ 0 }; i < count; ++i)
+                    total += data[i];
+
+                return total;
+            }
+        }
+
+        template <typename T>
+        void merge_totals(Total<T>& into, const Total<T>& from)
+        {
+            if constexpr (std::is_floating_point_v<T>)
+                into.merge(from);
+            else
+                into += from;
+        }
+
+        /// the smaller (or larger, if Larger) of the values, first must be < last
+        template <bool Larger, typename T>
+        T extreme_part(const T* data, std::size_t first, std::size_t last)
+        {
+            auto better = [](const T& candidate, const T& best) -> bool {
+                if constexpr (Larger)
+                    return best < candidate;
+                else
+                    return candidate < best;
+            };
+
+            if constexpr (std::is_arithmetic_v<T>)
+            {
+                if (last - first >= s_lanes)
+                {
+                    T lanes[s_lanes]{};
+                    for (std::size_t lane{ 0 }; lane < s_lanes; ++lane)
+                        lanes[lane] = data[first + lane];
+
+                    std::size_t i{ first + s_lanes };
+                    for (; i + s_lanes <= last; i += s_lanes)
+                        for (std::size_t lane{ 0 }; lane < s_lanes; ++lane)
+                            lanes[lane] = better(data[i + lane], lanes[lane]) ? data[i + lane] : lanes[lane];
+
+                    T best{ lanes[0] };
+                    for (std::size_t lane{ 1 }; lane < s_lanes; ++lane)
+                        best = better(lanes[lane], best) ? lanes[lane] : best;
+
+                    for (; i < last; ++i)
+                        best = better(data[i], best) ? data[i] : best;
+
+                    return best;
+                }
+            }
+
+            T best{ data[first] };
+            for (std::size_t i{ first + 1 }; i < last; ++i)
+                if (better(data[i], best))
+                    best = data[i];
+
+            return best;
+        }
+
+        /// statistics of at most a few thousand values, mean first, then the squared differences,
+        /// both passes over data that is still in the cache
+        template <typename T>
+        Statistics statistics_block(const T* data, std::size_t count)
+        {
+            double sums[s_lanes]{};
+            double mins[s_lanes]{};
+            double maxs[s_lanes]{};
+
+            for (std::size_t lane{ 0 }; lane < s_lanes; ++lane)
+                mins[lane] = maxs[lane] = static_cast<double>(data[0]);
+
+            std::size_t i{ 0 };
+            for (; i + s_lanes <= count; i += s_lanes)
+            {
+                for (std::size_t lane{ 0 }; lane < s_lanes; ++lane)
+                {
+                    const double value{ static_cast<double>(data[i + lane]) };
+                    sums[lane] += value;
+                    mins[lane] = value < mins[lane] ? value : mins[lane];
+                    maxs[lane] = maxs[lane] < value ? value : maxs[lane];
+                }
+            }
+
+            Statistics result{};
+            result.count = count;
+            result.min = mins[0];
+            result.max = maxs[0];
+
+            double sum{ 0.0 };
+            for (std::size_t lane{ 0 }; lane < s_lanes; ++lane)
+            {
+                sum += sums[lane];
+                result.min = std::min(result.min, mins[lane]);
+                result.max = std::max(result.max, maxs[lane]);
+            }
+
+            for (; i < count; ++i)
+            {
+                const double value{ static_cast<double>(data[i]) };
+                sum += value;
+                result.min = std::min(result.min, value);
+                result.max = std::max(result.max, value);
+            }
+
+            result.mean = sum / static_cast<double>(count);
+
+            double squares[s_lanes]{};
+            for (i = 0; i + s_lanes <= count; i += s_lanes)
+            {
+                for (std::size_t lane{ 0 }; lane < s_lanes; ++lane)
+                {
+                    const double difference{ static_cast<double>(data[i + lane]) - result.mean };
+                    squares[lane] += difference * difference;
+                }
+            }
+
+            for (; i < count; ++i)
+            {
+                const double difference{ static_cast<double>(data[i]) - result.mean };
+                result.m2 += difference * difference;
+            }
+
+            for (double square : squares)
+                result.m2 += square;
+
+            return result;
+        }
+    }
+
+    /// the exact sum for integers (as long as it fits into the result type), the compensated sum for
+    /// floating point numbers, the += sum for other types
+    template <typename T>
+    auto sum(const T* data, std::size_t count, const Options& options = {})
+    {
+        using Total = detail::Total<T>;
+
+        const Total total{ detail::parallel<Total>(count, options,
+                                                   [data](std::size_t first, std::size_t last) { return detail::sum_part(data + first, last - first); },
+                                                   [](Total& into, const Total& from) { detail::merge_totals<T>(into, from); }) };
+
+        if constexpr (std::is_integral_v<T>)
+            return static_cast<std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>(total);
+        else if constexpr (std::is_floating_point_v<T>)
+            return total.value();
+        else
+            return total;
+    }
+
+    /// same result as average() in main.cpp, integer averages are rounded towards zero, but nothing
+    /// overflows: the total is kept in a wider type and only the average has to fit into T
+    template <typename T>
+    T average(const T* data, std::size_t count, const Options& options = {})
+    {
+        assert(count > 0 && "average() of no values");
+
+        using Total = detail::Total<T>;
+
+        Total total{ detail::parallel<Total>(count, options,
+                                             [data](std::size_t first, std::size_t last) { return detail::sum_part(data + first, last - first); },
+                                             [](Total& into, const Total& from) { detail::merge_totals<T>(into, from); }) };
+
+        if constexpr (std::is_integral_v<T>)
+            return static_cast<T>(total / static_cast<Total>(count));
+        else if constexpr (std::is_floating_point_v<T>)
+            return static_cast<T>(total.value() / static_cast<decltype(total.sum)>(count));
+        else
+        {
+            /// like the original average(), the type only has to know how to divide itself by an int count
+            assert(count <= static_cast<std::size_t>(std::numeric_limits<int>::max()) && "too many values for T's /= int");
+            total /= static_cast<int>(count);
+            return total;
+        }
+    }
+
+    template <typename T>
+    T min(const T* data, std::size_t count, const Options& options = {})
+    {
+        assert(count > 0 && "min() of no values");
+
+        return detail::parallel<T>(count, options,
+                                   [data](std::size_t first, std::size_t last) { return detail::extreme_part<false>(data, first, last); },
+                                   [](T& into, const T& from) { if (from < into) into = from; });
+    }
+
+    template <typename T>
+    T max(const T* data, std::size_t count, const Options& options = {})
+    {
+        assert(count > 0 && "max() of no values");
+
+        return detail::parallel<T>(count, options,
+                                   [data](std::size_t first, std::size_t last) { return detail::extreme_part<true>(data, first, last); },
+                                   [](T& into, const T& from) { if (into < from) into = from; });
+    }
+
+    /// count, mean, variance, min and max in one pass over the values
+    template <typename T>
+    Statistics statistics(const T* data, std::size_t count, const Options& options = {})
+    {
+        static_assert(std::is_arithmetic_v<T>, "statistics() needs numbers");
+
+        return detail::parallel<Statistics>(count, options,
+                                            [data](std::size_t first, std::size_t last) {
+                                                Statistics result{};
+                                                for (std::size_t block{ first }; block < last; block += detail::s_block_size)
+                                                    result.merge(detail::statistics_block(data + block, std::min(detail::s_block_size, last - block)));
+
+                                                return result;
+                                            },
+                                            [](Statistics& into, const Statistics& from) { into.merge(from); });
+    }
+}
+
+#endif /* Reduce_h */
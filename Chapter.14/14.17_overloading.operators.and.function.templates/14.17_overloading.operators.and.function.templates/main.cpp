@@ -23,6 +23,9 @@
  */
 
 #include <iostream>
+#include <vector>
+#include <limits>
+#include "Reduce.h"
 
 class Cents
 {
@@ -105,7 +108,27 @@ int main()
     std::cout << average(B, 4) << '\n';
     
     Cents cents_array[] { Cents{ 5 }, Cents{ 10 }, Cents{ 15 }, Cents{ 14 } };
-    std::cout << average(cents_array, 4);
+    std::cout << average(cents_array, 4) << '\n';
+    
+    /// the same averages with Reduce, Cents works through its += and /=
+    std::cout << Reduce::average(A, 5) << ' ' << Reduce::average(B, 4) << ' ' << Reduce::average(cents_array, 4) << '\n';
+    
+    /// average() would overflow T sum{ 0 } after the second of these, Reduce adds them in a wider type
+    std::vector<int> large(10'000'000, std::numeric_limits<int>::max());
+    std::cout << Reduce::average(large.data(), large.size()) << '\n';
+    
+    /// adding 0.1 ten million times, plain += drifts away from 1000000
+    std::vector<double> tenths(10'000'000, 0.1);
+    double plain_sum{ 0.0 };
+    for (double value : tenths)
+        plain_sum += value;
+    
+    std::cout.precision(17);
+    std::cout << plain_sum << " vs " << Reduce::sum(tenths.data(), tenths.size()) << '\n';
+    
+    const Reduce::Statistics statistics{ Reduce::statistics(B, 4) };
+    std::cout << "mean " << statistics.mean << ", variance " << statistics.variance() << ", min " << statistics.min
+              << ", max " << statistics.max << '\n';
     
     return 0;
 }
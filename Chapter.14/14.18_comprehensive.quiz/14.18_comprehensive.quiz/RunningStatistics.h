@@ -0,0 +1,377 @@
+//
+//  RunningStatistics.h
+//  14.18_comprehensive.quiz
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef RunningStatistics_h
+#define RunningStatistics_h
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+/// Approximate quantiles (median, 99th percentile, ...) of a stream of numbers in little memory
+/// values are counted in buckets whose width grows with the value, so every quantile is within a fixed
+/// relative error (1% by default) of the true one, no matter how many values were added
+/// two sketches with the same accuracy are merged by adding their bucket counts
+class QuantileSketch
+{
+private:
+    /// counts of one sign, bucket i of m_counts is bucket number m_offset + i
+    struct Store
+    {
+        std::vector<std::uint64_t> counts{};
+        int offset{ 0 };
+
+        void add(int bucket, std::uint64_t count)
+        {
+            if (counts.empty())
+            {
+                counts.assign(1, 0);
+                offset = bucket;
+            }
+            else if (bucket < offset)
+            {
+                counts.insert(counts.begin(), static_cast<std::size_t>(offset - bucket), 0);
+                offset = bucket;
+            }
+            else if (bucket >= offset + static_cast<int>(counts.size()))
+                counts.resize(static_cast<std::size_t>(bucket - offset + 1), 0);
+
+            counts[static_cast<std::size_t>(bucket - offset)] += count;
+        }
+
+        void merge(const Store& other)
+        {
+            for (std::size_t i{ 0 }; i < other.counts.size(); ++i)
+                if (other.counts[i] > 0)
+                    add(other.offset + static_cast<int>(i), other.counts[i]);
+        }
+    };
+
+    double m_accuracy{};
+    double m_gamma{};
+    double m_log_gamma{};
+
+    Store m_positive{};
+    Store m_negative{};             /// bucket of -value
+    std::uint64_t m_zeros{ 0 };     /// values too close to 0 to have a bucket
+    std::uint64_t m_count{ 0 };
+
+    static constexpr double s_smallest{ 1e-9 };
+
+    int bucket(double magnitude) const { return static_cast<int>(std::ceil(std::log(magnitude) / m_log_gamma)); }
+
+    /// the value in the middle of a bucket, at most m_accuracy away from everything counted in it
+    double value_of(int bucket) const { return 2.0 * std::pow(m_gamma, bucket) / (m_gamma + 1.0); }
+
+public:
+    /// accuracy is the largest relative error of a quantile, e.g. 0.01 for 1%
+    explicit QuantileSketch(double accuracy = 0.01)
+        : m_accuracy{ std::clamp(accuracy, 1e-6, 0.5) },
+          m_gamma{ (1.0 + m_accuracy) / (1.0 - m_accuracy) },
+          m_log_gamma{ std::log(m_gamma) }
+    {
+    }
+
+    /// NaN and infinities have no bucket, they are not counted
+    void add(double value)
+    {
+        if (!std::isfinite(value))
+            return;
+
+        ++m_count;
+
+        if (value > s_smallest)
+            m_positive.add(bucket(value), 1);
+        else if (value < -s_smallest)
+            m_negative.add(bucket(-value), 1);
+        else
+            ++m_zeros;
+    }
+
+    void merge(const QuantileSketch& other)
+    {
+        assert(m_accuracy == other.m_accuracy && "only sketches with the same accuracy can be merged");
+
+        m_positive.merge(other.m_positive);
+        m_negative.merge(other.m_negative);
+        m_zeros += other.m_zeros;
+        m_count += other.m_count;
+    }
+
+    /// q between 0 (smallest value) and 1 (largest value), 0.5 is the median
+    double quantile(double q) const
+    {
+        if (m_count == 0)
+            return std::numeric_limits<double>::quiet_NaN();
+
+        const std::uint64_t rank{ static_cast<std::uint64_t>(std::clamp(q, 0.0, 1.0) * static_cast<double>(m_count - 1)) };
+        std::uint64_t seen{ 0 };
+
+        /// negative values from the most negative, which is the largest bucket
+        for (std::size_t i{ m_negative.counts.size() }; i-- > 0; )
+        {
+            seen += m_negative.counts[i];
+            if (seen > rank)
+                return -value_of(m_negative.offset + static_cast<int>(i));
+        }
+
+        seen += m_zeros;
+        if (seen > rank)
+            return 0.0;
+
+        for (std::size_t i{ 0 }; i < m_positive.counts.size(); ++i)
+        {
+            seen += m_positive.counts[i];
+            if (seen > rank)
+                return value_of(m_positive.offset + static_cast<int>(i));
+        }
+
+        return value_of(m_positive.offset + static_cast<int>(m_positive.counts.size()) - 1);
+    }
+
+    double accuracy() const { return m_accuracy; }
+    std::uint64_t count() const { return m_count; }
+};
+
+/// Count, mean, variance, min and max of a stream of numbers, without storing the numbers
+/// - the count is 64-bit, so it doesn't wrap around like Average's std::int8_t after 127 numbers
+/// - mean and variance are updated with Welford's method, which stays accurate where the
+///   sum-of-squares formula loses all precision (large values that are close together)
+/// - merge() combines two accumulators as if all their numbers had been added to one, so every
+///   thread or shard can fill its own and they are combined at the end
+/// - += also takes a whole array (std::vector, std::array, C array), which is added a block at a
+///   time with several independent accumulators, so the loops vectorize, and one merge per block
+///   instead of a division per number
+/// - NaN and infinities are skipped, by every += and by the quantile sketch, so they never end up
+///   in the count, the mean or the quantiles
+/// - quantiles are only tracked if asked for in the constructor, they cost a bucket update per number
+class RunningStatistics
+{
+private:
+    std::uint64_t m_count{ 0 };
+    double m_mean{ 0.0 };
+    double m_m2{ 0.0 };         /// sum of squared differences from the mean
+    double m_min{ std::numeric_limits<double>::infinity() };
+    double m_max{ -std::numeric_limits<double>::infinity() };
+
+    std::optional<QuantileSketch> m_sketch{};
+
+    /// independent accumulators per loop, enough to fill two 256-bit vector registers
+    static constexpr std::size_t s_lanes{ 8 };
+    static constexpr std::size_t s_block_size{ 4096 };
+
+    /// combines the count/mean/m2/min/max of another set of numbers (Chan's formula)
+    void merge_moments(std::uint64_t count, double mean, double m2, double min, double max)
+    {
+        if (count == 0)
+            return;
+
+        const std::uint64_t total{ m_count + count };
+        const double delta{ mean - m_mean };
+
+        m_mean += delta * static_cast<double>(count) / static_cast<double>(total);
+        m_m2 += m2 + delta * delta * static_cast<double>(m_count) * static_cast<double>(count) / static_cast<double>(total);
+        m_min = std::min(m_min, min);
+        m_max = std::max(m_max, max);
+        m_count = total;
+    }
+
+    /// a block small enough to stay in the cache: its mean first, then the squared differences from
+    /// that mean, and the result is merged in like another accumulator
+    /// every lane has its own count, sum, min and max, the lanes don't depend on each other, so the
+    /// compiler can put them side by side in vector registers; they are combined at the end
+    template <typename T>
+    void add_block(const T* data, std::size_t count)
+    {
+        constexpr double infinity{ std::numeric_limits<double>::infinity() };
+
+        double counts[s_lanes]{};
+        double sums[s_lanes]{};
+        double mins[s_lanes]{};
+        double maxs[s_lanes]{};
+
+        for (std::size_t lane{ 0 }; lane < s_lanes; ++lane)
+        {
+            mins[lane] = infinity;
+            maxs[lane] = -infinity;
+        }
+
+        /// value - value is 0 only for a finite value, NaN and infinities add nothing to any lane
+        /// the lane loops are kept rolled: g++ -O3 unrolls them into 8 scalar operations otherwise, and
+        /// only a loop gets vectorized
+        std::size_t i{ 0 };
+        for (; i + s_lanes <= count; i += s_lanes)
+        {
+#pragma GCC unroll 1
+            for (std::size_t lane{ 0 }; lane < s_lanes; ++lane)
+            {
+                const double value{ static_cast<double>(data[i + lane]) };
+                const bool finite{ value - value == 0.0 };
+
+                /// all the selects first, then the updates, so the lane loop has no branches
+                const double one{ finite ? 1.0 : 0.0 };
+                const double kept{ finite ? value : 0.0 };
+                const double low{ finite ? value : infinity };
+                const double high{ finite ? value : -infinity };
+
+                counts[lane] += one;
+                sums[lane] += kept;
+                mins[lane] = low < mins[lane] ? low : mins[lane];
+                maxs[lane] = maxs[lane] < high ? high : maxs[lane];
+            }
+        }
+
+        for (; i < count; ++i)
+        {
+            const double value{ static_cast<double>(data[i]) };
+            if (std::isfinite(value))
+            {
+                counts[0] += 1.0;
+                sums[0] += value;
+                mins[0] = std::min(mins[0], value);
+                maxs[0] = std::max(maxs[0], value);
+            }
+        }
+
+        double finite_count{ 0.0 };
+        double sum{ 0.0 };
+        double min{ infinity };
+        double max{ -infinity };
+
+        for (std::size_t lane{ 0 }; lane < s_lanes; ++lane)
+        {
+            finite_count += counts[lane];
+            sum += sums[lane];
+            min = std::min(min, mins[lane]);
+            max = std::max(max, maxs[lane]);
+        }
+
+        if (finite_count == 0.0)
+            return;
+
+        const double mean{ sum / finite_count };
+
+        double squares[s_lanes]{};
+        for (i = 0; i + s_lanes <= count; i += s_lanes)
+        {
+#pragma GCC unroll 1
+            for (std::size_t lane{ 0 }; lane < s_lanes; ++lane)
+            {
+                const double value{ static_cast<double>(data[i + lane]) };
+                const double kept{ value - value == 0.0 ? value : mean };
+                const double difference{ kept - mean };
+                squares[lane] += difference * difference;
+            }
+        }
+
+        double m2{ 0.0 };
+        for (; i < count; ++i)
+        {
+            const double value{ static_cast<double>(data[i]) };
+            if (std::isfinite(value))
+                m2 += (value - mean) * (value - mean);
+        }
+
+        for (double square : squares)
+            m2 += square;
+
+        merge_moments(static_cast<std::uint64_t>(finite_count), mean, m2, min, max);
+
+        if (m_sketch)
+            for (i = 0; i < count; ++i)
+                m_sketch->add(static_cast<double>(data[i]));
+    }
+
+public:
+    RunningStatistics() = default;
+
+    /// also tracks quantiles, within quantile_accuracy relative error
+    explicit RunningStatistics(double quantile_accuracy) : m_sketch{ QuantileSketch{ quantile_accuracy } }
+    {
+    }
+
+    RunningStatistics& operator+=(double value)
+    {
+        if (!std::isfinite(value))
+            return *this;
+
+        ++m_count;
+
+        const double delta{ value - m_mean };
+        m_mean += delta / static_cast<double>(m_count);
+        m_m2 += delta * (value - m_mean);
+        m_min = std::min(m_min, value);
+        m_max = std::max(m_max, value);
+
+        if (m_sketch)
+            m_sketch->add(value);
+
+        return *this;
+    }
+
+    /// adds every number of a std::vector, std::array or C array
+    template <typename Container, typename = std::enable_if_t<std::is_arithmetic_v<std::remove_cv_t<std::remove_reference_t<decltype(*std::data(std::declval<const Container&>()))>>>>>
+    RunningStatistics& operator+=(const Container& values)
+    {
+        return add(std::data(values), std::size(values));
+    }
+
+    template <typename T>
+    RunningStatistics& add(const T* data, std::size_t count)
+    {
+        static_assert(std::is_arithmetic_v<T>, "RunningStatistics adds numbers");
+
+        for (std::size_t first{ 0 }; first < count; first += s_block_size)
+            add_block(data + first, std::min(s_block_size, count - first));
+
+        return *this;
+    }
+
+    /// as if every number added to other had been added here too
+    /// quantiles are only kept if both sides track them
+    RunningStatistics& merge(const RunningStatistics& other)
+    {
+        merge_moments(other.m_count, other.m_mean, other.m_m2, other.m_min, other.m_max);
+
+        if (m_sketch && other.m_sketch)
+            m_sketch->merge(*other.m_sketch);
+        else if (m_sketch && other.m_count > 0)
+            m_sketch.reset();
+
+        return *this;
+    }
+
+    std::uint64_t count() const { return m_count; }
+    double mean() const { return m_count > 0 ? m_mean : std::numeric_limits<double>::quiet_NaN(); }
+
+    /// population variance, and the sample variance (divided by count - 1)
+    double variance() const { return m_count > 0 ? m_m2 / static_cast<double>(m_count) : 0.0; }
+    double sample_variance() const { return m_count > 1 ? m_m2 / static_cast<double>(m_count - 1) : 0.0; }
+    double standard_deviation() const { return std::sqrt(variance()); }
+
+    double min() const { return m_min; }
+    double max() const { return m_max; }
+
+    bool has_quantiles() const { return m_sketch.has_value(); }
+
+    double quantile(double q) const
+    {
+        assert(m_sketch && "construct RunningStatistics with a quantile accuracy to track quantiles");
+        return m_sketch ? m_sketch->quantile(q) : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double median() const { return quantile(0.5); }
+};
+
+#endif /* RunningStatistics_h */
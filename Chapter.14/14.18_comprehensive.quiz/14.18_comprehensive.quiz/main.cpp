@@ -85,9 +85,14 @@
 #include <cstdint>
 #include <cassert>
 #include <cmath>
+#include <vector>
+#include "RunningStatistics.h"
 
 
 /*----------------------------------------------------------------------------------------*/
+/// the quiz version kept the total and the count in small integers, the count wraps around after
+/// 127 numbers, RunningStatistics keeps a 64-bit count and a running mean instead
+/*
 class Average
 {
 private:
@@ -116,6 +121,33 @@ std::ostream& operator<<(std::ostream& out, const Average& a)
     out << static_cast<double>(a.m_total) / a.m_numbers;
     return out;
 }
+*/
+
+class Average
+{
+private:
+    RunningStatistics m_statistics{};
+    
+public:
+    Average() {}
+    
+    /// modifies the left operand, so it should be a member function
+    Average& operator+=(int num);
+    
+    friend std::ostream& operator<<(std::ostream& out, const Average& a);
+};
+
+Average& Average::operator+=(int num)
+{
+    m_statistics += num;
+    return *this;       /// for chaining the +='s together
+}
+
+std::ostream& operator<<(std::ostream& out, const Average& a)
+{
+    out << a.m_statistics.mean();
+    return out;
+}
 /*----------------------------------------------------------------------------------------*/
 
 
@@ -314,6 +346,25 @@ int main()
     Average copy{ avg };
     std::cout << copy << '\n';
     
+    /// every thread (here: two loops) fills its own accumulator, merge() combines them
+    std::vector<double> first_half(1000);
+    std::vector<double> second_half(1000);
+    for (int i{ 0 }; i < 1000; ++i)
+    {
+        first_half[i] = 1 + i;
+        second_half[i] = 1001 + i;
+    }
+    
+    RunningStatistics first{ 0.01 };
+    RunningStatistics second{ 0.01 };
+    first += first_half;
+    second += second_half;
+    first.merge(second);
+    
+    std::cout << "count " << first.count() << ", mean " << std::fixed << first.mean() << ", variance " << first.variance()
+              << ", min " << first.min() << ", max " << first.max() << ", median ~" << first.median() << ", 99th percentile ~" << first.quantile(0.99) << '\n';
+    std::cout.unsetf(std::ios::floatfield);
+    
     
     
     
@@ -0,0 +1,204 @@
+//
+//  TerminalRenderer.h
+//  14.19_project.15puzzle
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef TerminalRenderer_h
+#define TerminalRenderer_h
+
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include <unistd.h>
+
+/// Draws a rectangle of characters on an ANSI terminal, redrawing only what changed since the last frame
+/// - a frame is composed in memory with put() and write(), nothing reaches the terminal until present()
+/// - present() compares the frame with the one on screen and, for every run of changed characters,
+///   moves the cursor there with an escape code and writes just that run
+/// - everything present() sends is collected in one buffer, allocated once in the constructor, and
+///   handed to the terminal in a single write() call
+/// - afterwards the cursor is left on the line below the frame, so prompts and typed input appear
+///   under it
+/// POSIX only (macOS, Linux)
+class TerminalRenderer
+{
+private:
+    /// unchanged characters between two changed runs shorter than this are simply written again,
+    /// that's fewer bytes than an escape code to jump over them
+    static constexpr int s_max_gap{ 6 };
+
+    /// longest cursor movement: "\x1b[" + row + ';' + column + 'H', with up to 10 digits per number
+    static constexpr std::size_t s_move_size{ 24 };
+
+    int m_width{};
+    int m_height{};
+    int m_descriptor{ STDOUT_FILENO };
+
+    std::vector<char> m_frame{};        /// being composed
+    std::vector<char> m_screen{};       /// what the terminal shows
+    bool m_screen_known{ false };       /// false until the first present(), or after invalidate()
+
+    std::vector<char> m_output{};
+    std::size_t m_output_length{ 0 };
+
+    char* cell(std::vector<char>& cells, int x, int y) { return cells.data() + static_cast<std::size_t>(y) * m_width + x; }
+
+    void emit(const char* data, std::size_t length)
+    {
+        std::copy_n(data, length, m_output.data() + m_output_length);
+        m_output_length += length;
+    }
+
+    void emit(std::string_view text) { emit(text.data(), text.size()); }
+
+    /// terminal rows and columns start at 1
+    void emit_move(int row, int column)
+    {
+        char text[s_move_size]{ '\x1b', '[' };
+        std::size_t length{ 2 };
+
+        auto append_number = [&](int number) {
+            char digits[12]{};
+            int count{ 0 };
+            do
+            {
+                digits[count++] = static_cast<char>('0' + number % 10);
+                number /= 10;
+            }
+            while (number > 0);
+
+            while (count > 0)
+                text[length++] = digits[--count];
+        };
+
+        append_number(row);
+        text[length++] = ';';
+        append_number(column);
+        text[length++] = 'H';
+
+        emit(text, length);
+    }
+
+public:
+    /// descriptor -1 composes the output without writing it anywhere, see output()
+    TerminalRenderer(int width, int height, int descriptor = STDOUT_FILENO)
+        : m_width{ std::max(width, 1) }, m_height{ std::max(height, 1) }, m_descriptor{ descriptor }
+    {
+        const std::size_t cells{ static_cast<std::size_t>(m_width) * static_cast<std::size_t>(m_height) };
+
+        m_frame.assign(cells, ' ');
+        m_screen.assign(cells, ' ');
+
+        /// worst case: a cursor movement before every character, plus clearing the screen
+        m_output.resize(cells * (s_move_size + 1) + 4 * s_move_size);
+    }
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+
+    /// fills the frame with spaces
+    void clear() { std::fill(m_frame.begin(), m_frame.end(), ' '); }
+
+    /// characters outside the frame are ignored
+    void put(int x, int y, char ch)
+    {
+        if (x >= 0 && x < m_width && y >= 0 && y < m_height)
+            *cell(m_frame, x, y) = ch;
+    }
+
+    /// text is cut off at the right edge of the frame, it doesn't wrap to the next line
+    void write(int x, int y, std::string_view text)
+    {
+        if (y < 0 || y >= m_height || x >= m_width)
+            return;
+
+        if (x < 0)
+        {
+            if (static_cast<std::size_t>(-x) >= text.size())
+                return;
+
+            text.remove_prefix(static_cast<std::size_t>(-x));
+            x = 0;
+        }
+
+        const std::size_t length{ std::min(text.size(), static_cast<std::size_t>(m_width - x)) };
+        std::copy_n(text.data(), length, cell(m_frame, x, y));
+    }
+
+    /// the next present() redraws everything, e.g. after something else was printed over the frame
+    void invalidate() { m_screen_known = false; }
+
+    /// sends the changes since the last present() to the terminal, returns the number of bytes sent
+    std::size_t present()
+    {
+        m_output_length = 0;
+
+        if (!m_screen_known)
+        {
+            /// clear the screen, the frame starts at the top left corner
+            emit("\x1b[2J");
+            std::fill(m_screen.begin(), m_screen.end(), ' ');
+            m_screen_known = true;
+        }
+
+        for (int y{ 0 }; y < m_height; ++y)
+        {
+            const char* frame{ cell(m_frame, 0, y) };
+            char* screen{ cell(m_screen, 0, y) };
+
+            int x{ 0 };
+            while (x < m_width)
+            {
+                if (frame[x] == screen[x])
+                {
+                    ++x;
+                    continue;
+                }
+
+                /// a run of changes, extended across short unchanged gaps
+                const int first{ x };
+                int last{ x + 1 };
+                for (int next{ last }; next < m_width && next - last < s_max_gap; ++next)
+                    if (frame[next] != screen[next])
+                        last = next + 1;
+
+                emit_move(y + 1, first + 1);
+                emit(frame + first, static_cast<std::size_t>(last - first));
+                std::copy(frame + first, frame + last, screen + first);
+
+                x = last;
+            }
+        }
+
+        /// cursor below the frame, and whatever was typed there last time is erased
+        emit_move(m_height + 1, 1);
+        emit("\x1b[J");
+
+        if (m_descriptor >= 0)
+        {
+            const char* data{ m_output.data() };
+            std::size_t remaining{ m_output_length };
+
+            while (remaining > 0)
+            {
+                const ssize_t written{ ::write(m_descriptor, data, remaining) };
+                if (written <= 0)
+                    break;
+
+                data += written;
+                remaining -= static_cast<std::size_t>(written);
+            }
+        }
+
+        return m_output_length;
+    }
+
+    /// the bytes the last present() sent
+    std::string_view output() const { return { m_output.data(), m_output_length }; }
+};
+
+#endif /* TerminalRenderer_h */
@@ -10,6 +10,9 @@
 #include <iostream>
 #include <numeric>
 #include "Random.h"
+#include "TerminalRenderer.h"
+
+#include <unistd.h>
 
 constexpr int g_console_lines{ 25 };
 
@@ -218,6 +221,31 @@ public:
         return stream;
     }
     
+    /// size of what draw() draws, four characters per tile
+    static constexpr int s_frame_width{ SIZE * 4 };
+    static constexpr int s_frame_height{ SIZE };
+    
+    /// the same picture as operator<<, drawn into the renderer's frame instead of streamed
+    /// the renderer then sends only the tiles that moved to the terminal
+    void draw(TerminalRenderer& renderer) const
+    {
+        for (int y{ 0 }; y < SIZE; ++y)
+        {
+            for (int x{ 0 }; x < SIZE; ++x)
+            {
+                const int number{ m_tiles[y][x].get_num() };
+                char text[4]{ ' ', ' ', ' ', ' ' };
+                
+                if (number > 9)
+                    text[1] = static_cast<char>('0' + number / 10);
+                if (number > 0)
+                    text[2] = static_cast<char>('0' + number % 10);
+                
+                renderer.write(x * 4, y, std::string_view{ text, 4 });
+            }
+        }
+    }
+    
     Point get_empty_tile_pos() const
     {
         for (int y = 0; y < SIZE; ++y)
@@ -284,7 +312,23 @@ int main()
 {
     Board board{};
     board.randomize();
-    std::cout << board;
+    
+    /// on a terminal the board is redrawn in place, otherwise (output redirected to a file) it is
+    /// printed after the empty lines as before
+    const bool on_terminal{ ::isatty(STDOUT_FILENO) == 1 };
+    TerminalRenderer renderer{ Board::s_frame_width, Board::s_frame_height };
+    
+    auto show = [&]() {
+        if (on_terminal)
+        {
+            board.draw(renderer);
+            renderer.present();
+        }
+        else
+            std::cout << board;
+    };
+    
+    show();
     
     while (!board.player_won())
     {
@@ -300,7 +344,7 @@ int main()
         
         bool user_moved { board.move_tile(dir) };
         if (user_moved)
-            std::cout << board;
+            show();
     }
     
     std::cout << "\n\nYOU WON!\n\n";
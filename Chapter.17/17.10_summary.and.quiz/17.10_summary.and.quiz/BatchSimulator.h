@@ -0,0 +1,306 @@
+//
+//  BatchSimulator.h
+//  17.10_summary.and.quiz
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef BatchSimulator_h
+#define BatchSimulator_h
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+/// Headless version of the Player vs. Monster game, used to balance the monster table
+/// The rules are the same as fightMonster()/attackMonster()/onMonsterKilled(), but nobody is asked
+/// anything: a Policy decides when to run and whether to drink potions
+/// Players are not Player objects, each property is kept in its own array (a component), so a tick
+/// walks a few tightly packed arrays of ints instead of a list of objects with strings in them
+namespace Simulation
+{
+    /// same indices as Monster::Type
+    enum MonsterType
+    {
+        dragon,
+        orc,
+        slime,
+        max_monster_types
+    };
+
+    struct MonsterStats
+    {
+        int health{};
+        int damage{};
+        int gold{};
+    };
+
+    using MonsterTable = std::array<MonsterStats, max_monster_types>;
+
+    /// same values as Monster::getDefaultCreature()
+    inline constexpr MonsterTable default_monsters{ {
+        { 20, 4, 100 },
+        { 4, 2, 25 },
+        { 1, 1, 10 } } };
+
+    /// the scripted replacement for reading (R)un or (F)ight and [y/n] from std::cin
+    struct Policy
+    {
+        /// run (instead of fighting) while the player's health is at or below this
+        int flee_at_health{ 0 };
+
+        /// always try to run from these monsters, indexed by MonsterType
+        std::array<bool, max_monster_types> flee_from{};
+
+        bool drink_potions{ true };
+    };
+
+    struct Config
+    {
+        std::uint64_t playthroughs{ 100000 };
+        unsigned int threads{ 0 };          /// 0 - use every hardware thread
+        std::uint64_t seed{ 5489 };
+        std::size_t batch_size{ 4096 };     /// players fighting at the same time in one shard
+        Policy policy{};
+        MonsterTable monsters{ default_monsters };
+    };
+
+    struct Report
+    {
+        static constexpr int s_winning_level{ 20 };
+
+        std::uint64_t playthroughs{};
+        std::uint64_t wins{};
+        std::uint64_t fights{};
+        std::uint64_t total_gold{};
+
+        /// level_counts[level] - number of playthroughs that ended at that level
+        std::array<std::uint64_t, s_winning_level + 1> level_counts{};
+
+        /// adds another shard's results to this one
+        void merge(const Report& other)
+        {
+            playthroughs += other.playthroughs;
+            wins += other.wins;
+            fights += other.fights;
+            total_gold += other.total_gold;
+
+            for (std::size_t level{ 0 }; level < level_counts.size(); ++level)
+                level_counts[level] += other.level_counts[level];
+        }
+
+        double win_rate() const { return playthroughs ? static_cast<double>(wins) / static_cast<double>(playthroughs) : 0.0; }
+
+        void print(std::ostream& out = std::cout) const
+        {
+            const std::ios_base::fmtflags flags{ out.flags() };
+            const std::streamsize precision{ out.precision() };
+
+            out << "Playthroughs: " << playthroughs << '\n';
+            out << "Win rate: " << std::fixed << std::setprecision(2) << win_rate() * 100.0 << "%\n";
+            out << "Fights: " << fights << "\tAverage gold: "
+                << (playthroughs ? static_cast<double>(total_gold) / static_cast<double>(playthroughs) : 0.0) << '\n';
+
+            out << "Final level distribution:\n";
+            for (std::size_t level{ 1 }; level < level_counts.size(); ++level)
+            {
+                if (level_counts[level] == 0)
+                    continue;
+
+                out << std::setw(4) << level << ": " << std::setw(6)
+                    << static_cast<double>(level_counts[level]) * 100.0 / static_cast<double>(playthroughs) << "%\n";
+            }
+
+            out.flags(flags);
+            out.precision(precision);
+        }
+    };
+
+    /// one independent piece of the simulation, owns its players and its own random engine
+    class Shard
+    {
+    private:
+        /// game rules from the interactive version
+        static constexpr int s_start_health{ 10 };
+        static constexpr int s_start_damage{ 1 };
+        static constexpr int s_potion_chance{ 30 };
+
+        const Config& m_config;
+        std::mt19937 m_rng;
+
+        /// components, index i in every array belongs to the same player
+        std::vector<int> m_health{};
+        std::vector<int> m_damage{};
+        std::vector<int> m_gold{};
+        std::vector<int> m_level{};
+
+        /// indices of players still playing
+        std::vector<std::uint32_t> m_active{};
+
+        Report m_report{};
+
+        int roll(int min, int max)
+        {
+            return std::uniform_int_distribution{ min, max }(m_rng);
+        }
+
+        void drink_random_potion(std::uint32_t player)
+        {
+            /// same potion types and sizes as the Potion class: health/strength/poison, small/medium/large
+            const int type{ roll(0, 2) };
+            const int size{ roll(0, 2) };
+
+            if (type == 0)
+                m_health[player] += (size == 2) ? 5 : 2;
+            else if (type == 1)
+                ++m_damage[player];
+            else
+                --m_health[player];
+        }
+
+        /// one whole fightMonster() for one player
+        void fight(std::uint32_t player)
+        {
+            const int type{ roll(0, max_monster_types - 1) };
+            const MonsterStats& stats{ m_config.monsters[static_cast<std::size_t>(type)] };
+            const Policy& policy{ m_config.policy };
+
+            int monster_health{ stats.health };
+            ++m_report.fights;
+
+            while (monster_health > 0 && m_health[player] > 0)
+            {
+                if (policy.flee_from[static_cast<std::size_t>(type)] || m_health[player] <= policy.flee_at_health)
+                {
+                    /// 50% chance to flee, otherwise the monster gets a free hit
+                    if (roll(1, 2) == 1)
+                        return;
+
+                    m_health[player] -= stats.damage;
+                    continue;
+                }
+
+                monster_health -= m_damage[player];
+
+                if (monster_health <= 0)
+                {
+                    ++m_level[player];
+                    ++m_damage[player];
+                    m_gold[player] += stats.gold;
+
+                    if (roll(1, 100) <= s_potion_chance && policy.drink_potions)
+                        drink_random_potion(player);
+
+                    return;
+                }
+
+                m_health[player] -= stats.damage;
+            }
+        }
+
+        void record(std::uint32_t player)
+        {
+            ++m_report.playthroughs;
+            m_report.total_gold += static_cast<std::uint64_t>(m_gold[player]);
+
+            const int level{ std::min(m_level[player], Report::s_winning_level) };
+            ++m_report.level_counts[static_cast<std::size_t>(level)];
+
+            if (m_health[player] > 0)
+                ++m_report.wins;
+        }
+
+    public:
+        /// every shard seeds its own engine from (seed, shard index), so the shards never share
+        /// state and a run is reproducible for the same seed and shard count
+        Shard(const Config& config, std::uint64_t shard_index)
+            : m_config{ config }
+            , m_rng{ [&] {
+                std::seed_seq sequence{
+                    static_cast<std::uint32_t>(config.seed), static_cast<std::uint32_t>(config.seed >> 32),
+                    static_cast<std::uint32_t>(shard_index), static_cast<std::uint32_t>(shard_index >> 32) };
+                return std::mt19937{ sequence };
+            }() }
+        {
+        }
+
+        /// plays count games to the end, batch_size of them at a time
+        const Report& run(std::uint64_t count)
+        {
+            const std::size_t batch{ std::max<std::size_t>(m_config.batch_size, 1) };
+
+            while (count > 0)
+            {
+                const std::size_t players{ static_cast<std::size_t>(std::min<std::uint64_t>(count, batch)) };
+                count -= players;
+
+                m_health.assign(players, s_start_health);
+                m_damage.assign(players, s_start_damage);
+                m_gold.assign(players, 0);
+                m_level.assign(players, 1);
+
+                m_active.resize(players);
+                for (std::size_t player{ 0 }; player < players; ++player)
+                    m_active[player] = static_cast<std::uint32_t>(player);
+
+                /// one tick - every active player fights one monster, then finished players are removed
+                while (!m_active.empty())
+                {
+                    std::size_t kept{ 0 };
+
+                    for (std::uint32_t player : m_active)
+                    {
+                        fight(player);
+
+                        if (m_health[player] <= 0 || m_level[player] >= Report::s_winning_level)
+                            record(player);
+                        else
+                            m_active[kept++] = player;
+                    }
+
+                    m_active.resize(kept);
+                }
+            }
+
+            return m_report;
+        }
+    };
+
+    /// splits the playthroughs over the shards, runs each shard on its own thread and merges the reports
+    inline Report run(const Config& config)
+    {
+        unsigned int threads{ config.threads ? config.threads : std::thread::hardware_concurrency() };
+        threads = std::max(threads, 1u);
+
+        std::vector<Report> reports(threads);
+        std::vector<std::thread> workers{};
+
+        for (unsigned int index{ 0 }; index < threads; ++index)
+        {
+            /// first (playthroughs % threads) shards play one extra game
+            const std::uint64_t count{ config.playthroughs / threads + (index < config.playthroughs % threads ? 1 : 0) };
+
+            workers.emplace_back([&config, &reports, index, count] {
+                Shard shard{ config, index };
+                reports[index] = shard.run(count);
+            });
+        }
+
+        Report total{};
+        for (unsigned int index{ 0 }; index < threads; ++index)
+        {
+            workers[index].join();
+            total.merge(reports[index]);
+        }
+
+        return total;
+    }
+}
+
+#endif /* BatchSimulator_h */
@@ -47,6 +47,18 @@
  
  Generally avoid multiple inheritance unless alternatives lead to more complexity
  
+ -----------------------------------------------------------------------------------------------------------
+ BATCH SIMULATION:
+ 
+ The game below asks the player what to do on every turn, so it can only play one game at a time
+ 
+ BatchSimulator.h plays the same game without any input: a Policy decides when to run and whether to
+ drink potions, thousands of players are stored as plain arrays of health/damage/gold/level, the games are
+ split over several threads, each with its own random engine, and the results are printed as a win rate
+ and a distribution of the levels the players reached
+ 
+ Usage:     17.10_summary.and.quiz --simulate [playthroughs]
+ 
  -----------------------------------------------------------------------------------------------------------
  */
 
@@ -57,6 +69,8 @@
 #include <cstdlib>
 #include <ctime>
 #include <sstream> // for std::stringstream
+#include "BatchSimulator.h"
+#include "FastWriter.h"
 
 class Fruit
 {
@@ -177,12 +191,20 @@ public:
         // We use a std::stringstream, but this could also be solved using
         // std::string.
         // We first used std::stringstream in lesson 7.13.
-        std::stringstream result{};
+        /*std::stringstream result{};
 
         result << getPotionSizeName(getSize()) << " potion of " << getPotionTypeName(getType());
 
         // We can extract the string from an std::stringstream by using the str()
         // member function.
+        return result.str();*/
+
+        // A FastWriter builds the name in a small buffer on the stack, without the
+        // cost of constructing a stream.
+        FastWriter<64> result{};
+
+        result << getPotionSizeName(getSize()) << " potion of " << getPotionTypeName(getType());
+
         return result.str();
     }
 
@@ -393,8 +415,24 @@ void fightMonster(Player& player)
 }
 /*--------------------------------------------------------------------------------------------------------*/
 
-int main()
+int main(int argc, char* argv[])
 {
+    if (argc > 1 && std::string_view{ argv[1] } == "--simulate")
+    {
+        Simulation::Config config{};
+        
+        if (argc > 2)
+            config.playthroughs = std::strtoull(argv[2], nullptr, 10);
+        
+        /// a cautious player: run when low on health and always run from dragons
+        config.policy.flee_at_health = 3;
+        config.policy.flee_from[Simulation::dragon] = true;
+        
+        Simulation::run(config).print();
+        
+        return 0;
+    }
+    
     Apple a{ "red" };
     Banana b{};
     GrannySmith c{};
@@ -0,0 +1,205 @@
+//
+//  Dispatch.h
+//  25.6_the.virtual.table
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef Dispatch_h
+#define Dispatch_h
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <variant>
+#include <vector>
+
+/// Other ways to call func1 / func2 on a mix of Base, D1 and D2 objects than through the virtual table
+///
+/// a virtual call loads __vptr, loads the function address from the table and jumps there
+/// when the objects in a loop have mixed types, the CPU can't guess where the jump goes and
+/// has to throw away the work it started on the wrong guess, which costs more than the call itself
+///
+/// - Static::Base<Derived> (CRTP): the derived class is a template argument, so every call is
+///   decided at compile time and can be inlined, but there's no common base to point to
+/// - std::variant + std::visit: objects of the different types in one vector, by value; visit
+///   picks the function with a jump table on the index, still a jump but no pointers to chase
+/// - TypeGroups: one vector per type, a loop over a group always calls the same function, so
+///   nothing has to be guessed at all; it only works when the order of the objects doesn't matter
+/// - PointerGroups: the same grouping for objects that already exist behind Base pointers
+namespace Dispatch
+{
+    /// the lesson's classes with some work in the functions
+    namespace Virtual
+    {
+        class Base
+        {
+        protected:
+            unsigned int m_value{};
+
+        public:
+            explicit Base(unsigned int value) : m_value{ value } {}
+            virtual ~Base() = default;
+
+            virtual unsigned int func1(unsigned int x) const { return m_value + x; }
+            virtual unsigned int func2(unsigned int x) const { return m_value * x; }
+        };
+
+        class D1 : public Base
+        {
+        public:
+            using Base::Base;
+            unsigned int func1(unsigned int x) const override { return m_value - x; }
+        };
+
+        class D2 : public Base
+        {
+        public:
+            using Base::Base;
+            unsigned int func2(unsigned int x) const override { return m_value ^ x; }
+        };
+    }
+
+    /// the same classes with static polymorphism: Base<Derived> calls Derived's version if it has
+    /// one, otherwise its own, without any virtual function
+    namespace Static
+    {
+        template <class Derived>
+        class Base
+        {
+        protected:
+            unsigned int m_value{};
+
+            const Derived& derived() const { return static_cast<const Derived&>(*this); }
+
+        public:
+            explicit Base(unsigned int value) : m_value{ value } {}
+
+            unsigned int func1(unsigned int x) const { return derived().do_func1(x); }
+            unsigned int func2(unsigned int x) const { return derived().do_func2(x); }
+
+            /// the defaults, hidden by a derived class that defines its own
+            unsigned int do_func1(unsigned int x) const { return m_value + x; }
+            unsigned int do_func2(unsigned int x) const { return m_value * x; }
+        };
+
+        /// a plain Base object, CRTP needs a class to pass as Derived
+        class Plain : public Base<Plain>
+        {
+        public:
+            using Base::Base;
+        };
+
+        class D1 : public Base<D1>
+        {
+        public:
+            using Base::Base;
+            unsigned int do_func1(unsigned int x) const { return m_value - x; }
+        };
+
+        class D2 : public Base<D2>
+        {
+        public:
+            using Base::Base;
+            unsigned int do_func2(unsigned int x) const { return m_value ^ x; }
+        };
+
+        using Object = std::variant<Plain, D1, D2>;
+    }
+
+    /// objects stored by value in one vector per type
+    /// for_each visits a whole group before the next, in the order the types are listed
+    template <class... Types>
+    class TypeGroups
+    {
+    private:
+        std::tuple<std::vector<Types>...> m_groups{};
+
+    public:
+        template <class T>
+        std::vector<T>& group() { return std::get<std::vector<T>>(m_groups); }
+
+        template <class T>
+        const std::vector<T>& group() const { return std::get<std::vector<T>>(m_groups); }
+
+        template <class T>
+        void push_back(T object) { group<T>().push_back(std::move(object)); }
+
+        /// adds the object held by a variant to the group of its type
+        void push_back(const std::variant<Types...>& object)
+        {
+            std::visit([this](const auto& value) { push_back(value); }, object);
+        }
+
+        std::size_t size() const
+        {
+            return std::apply([](const auto&... groups) { return (groups.size() + ... + std::size_t{ 0 }); }, m_groups);
+        }
+
+        /// calls function(object) for every object, each group is a loop calling one function
+        template <class Function>
+        void for_each(Function&& function) const
+        {
+            std::apply([&function](const auto&... groups) {
+                (..., [&function](const auto& group) {
+                    for (const auto& object : group)
+                        function(object);
+                }(groups));
+            }, m_groups);
+        }
+    };
+
+    /// pointers to objects of a virtual hierarchy, sorted by their dynamic type
+    /// function gets a Derived&, so a qualified call like object.D1::func1(x) is a direct call
+    /// every object must be exactly one of the listed types (list BaseType too if there are plain
+    /// BaseType objects), otherwise the qualified call would pick the wrong function
+    template <class BaseType, class... Derived>
+    class PointerGroups
+    {
+    private:
+        std::tuple<std::vector<Derived*>...> m_groups{};
+
+        template <class T>
+        bool try_add(BaseType* object)
+        {
+            if (typeid(*object) != typeid(T))
+                return false;
+
+            std::get<std::vector<T*>>(m_groups).push_back(static_cast<T*>(object));
+            return true;
+        }
+
+    public:
+        PointerGroups() = default;
+
+        void add(BaseType* object)
+        {
+            [[maybe_unused]] const bool added{ (... || try_add<Derived>(object)) };
+            assert(added && "PointerGroups got an object of a type it doesn't list");
+        }
+
+        template <class Pointers>
+        explicit PointerGroups(const Pointers& objects)
+        {
+            for (const auto& object : objects)
+                add(&*object);
+        }
+
+        template <class Function>
+        void for_each(Function&& function) const
+        {
+            std::apply([&function](const auto&... groups) {
+                (..., [&function](const auto& group) {
+                    for (const auto* object : group)
+                        function(*object);
+                }(groups));
+            }, m_groups);
+        }
+    };
+}
+
+#endif /* Dispatch_h */
@@ -0,0 +1,237 @@
+//
+//  DispatchBenchmark.h
+//  25.6_the.virtual.table
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef DispatchBenchmark_h
+#define DispatchBenchmark_h
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "Dispatch.h"
+
+/// Calls func1 and func2 on the same objects in the same random order, through each mechanism:
+/// - virtual: Base* to objects made one by one with new, the usual way
+/// - switch: a type tag and a switch, the early binding version from 25.5
+/// - fn pointer: a type tag indexing a table of function pointers, late binding without classes
+/// - variant: std::vector<std::variant<...>> and std::visit
+/// - grouped: TypeGroups of the CRTP classes, one loop per type
+/// - grouped ptrs: PointerGroups over the virtual objects, one loop per type with direct calls
+/// each row is a mix of types: the more mixed, the harder the jumps are to predict
+/// every mechanism must add up to the same checksum, which is checked
+namespace DispatchBenchmark
+{
+    struct Mix
+    {
+        std::string name{};
+        std::array<double, 3> weights{};        /// Base, D1, D2
+    };
+
+    struct Result
+    {
+        std::string mix{};
+        std::vector<double> ns_per_object{};
+        bool checksums_match{};
+    };
+
+    inline const std::vector<std::string>& mechanisms()
+    {
+        static const std::vector<std::string> s_names{ "virtual", "switch", "fn pointer", "variant", "grouped", "grouped ptrs" };
+        return s_names;
+    }
+
+    namespace detail
+    {
+        enum Kind : unsigned char
+        {
+            base_kind,
+            d1_kind,
+            d2_kind,
+            max_kinds,
+        };
+
+        struct Tagged
+        {
+            Kind kind{};
+            unsigned int value{};
+        };
+
+        inline unsigned int call_switch(const Tagged& object, unsigned int x)
+        {
+            switch (object.kind)
+            {
+                case base_kind: return (object.value + x) + (object.value * x);
+                case d1_kind:   return (object.value - x) + (object.value * x);
+                case d2_kind:   return (object.value + x) + (object.value ^ x);
+                default:        return 0;
+            }
+        }
+
+        inline unsigned int call_base(unsigned int value, unsigned int x) { return (value + x) + (value * x); }
+        inline unsigned int call_d1(unsigned int value, unsigned int x) { return (value - x) + (value * x); }
+        inline unsigned int call_d2(unsigned int value, unsigned int x) { return (value + x) + (value ^ x); }
+
+        /// calls body() repetitions times, returns nanoseconds per object
+        template <class Body>
+        double time_per_object(std::size_t objects, int repetitions, unsigned int& checksum, Body body)
+        {
+            checksum = 0;
+            const auto start{ std::chrono::steady_clock::now() };
+            for (int r{ 0 }; r < repetitions; ++r)
+                checksum += body(static_cast<unsigned int>(r));
+            const auto stop{ std::chrono::steady_clock::now() };
+
+            const double nanoseconds{ static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()) };
+            return nanoseconds / (static_cast<double>(objects) * repetitions);
+        }
+    }
+
+    inline Result run(const Mix& mix, std::size_t count = 1 << 20, int repetitions = 20)
+    {
+        using namespace detail;
+
+        std::mt19937 random{ 2 };
+        std::discrete_distribution<int> pick{ mix.weights.begin(), mix.weights.end() };
+
+        std::vector<Tagged> tagged(count);
+        for (Tagged& object : tagged)
+            object = { static_cast<Kind>(pick(random)), static_cast<unsigned int>(random()) };
+
+        std::vector<std::unique_ptr<Dispatch::Virtual::Base>> pointers{};
+        std::vector<Dispatch::Static::Object> variants{};
+        Dispatch::TypeGroups<Dispatch::Static::Plain, Dispatch::Static::D1, Dispatch::Static::D2> groups{};
+
+        for (const Tagged& object : tagged)
+        {
+            switch (object.kind)
+            {
+                case base_kind:
+                    pointers.push_back(std::make_unique<Dispatch::Virtual::Base>(object.value));
+                    variants.emplace_back(Dispatch::Static::Plain{ object.value });
+                    break;
+                case d1_kind:
+                    pointers.push_back(std::make_unique<Dispatch::Virtual::D1>(object.value));
+                    variants.emplace_back(Dispatch::Static::D1{ object.value });
+                    break;
+                default:
+                    pointers.push_back(std::make_unique<Dispatch::Virtual::D2>(object.value));
+                    variants.emplace_back(Dispatch::Static::D2{ object.value });
+                    break;
+            }
+
+            groups.push_back(variants.back());
+        }
+
+        const Dispatch::PointerGroups<Dispatch::Virtual::Base, Dispatch::Virtual::Base, Dispatch::Virtual::D1, Dispatch::Virtual::D2> pointer_groups{ pointers };
+
+        using Function = unsigned int (*)(unsigned int, unsigned int);
+        constexpr std::array<Function, max_kinds> table{ call_base, call_d1, call_d2 };
+
+        Result result{};
+        result.mix = mix.name;
+        std::vector<unsigned int> checksums(mechanisms().size());
+
+        result.ns_per_object.push_back(time_per_object(count, repetitions, checksums[0], [&pointers](unsigned int x) {
+            unsigned int sum{ 0 };
+            for (const auto& object : pointers)
+                sum += object->func1(x) + object->func2(x);
+            return sum;
+        }));
+
+        result.ns_per_object.push_back(time_per_object(count, repetitions, checksums[1], [&tagged](unsigned int x) {
+            unsigned int sum{ 0 };
+            for (const Tagged& object : tagged)
+                sum += call_switch(object, x);
+            return sum;
+        }));
+
+        result.ns_per_object.push_back(time_per_object(count, repetitions, checksums[2], [&tagged, &table](unsigned int x) {
+            unsigned int sum{ 0 };
+            for (const Tagged& object : tagged)
+                sum += table[object.kind](object.value, x);
+            return sum;
+        }));
+
+        result.ns_per_object.push_back(time_per_object(count, repetitions, checksums[3], [&variants](unsigned int x) {
+            unsigned int sum{ 0 };
+            for (const Dispatch::Static::Object& object : variants)
+                sum += std::visit([x](const auto& o) { return o.func1(x) + o.func2(x); }, object);
+            return sum;
+        }));
+
+        result.ns_per_object.push_back(time_per_object(count, repetitions, checksums[4], [&groups](unsigned int x) {
+            unsigned int sum{ 0 };
+            groups.for_each([&sum, x](const auto& object) { sum += object.func1(x) + object.func2(x); });
+            return sum;
+        }));
+
+        result.ns_per_object.push_back(time_per_object(count, repetitions, checksums[5], [&pointer_groups](unsigned int x) {
+            unsigned int sum{ 0 };
+            pointer_groups.for_each([&sum, x](const auto& object) {
+                /// the qualified call names the exact function, so it isn't looked up in the virtual table
+                using Type = std::decay_t<decltype(object)>;
+                sum += object.Type::func1(x) + object.Type::func2(x);
+            });
+            return sum;
+        }));
+
+        result.checksums_match = true;
+        for (unsigned int checksum : checksums)
+            result.checksums_match = result.checksums_match && checksum == checksums[0];
+
+        return result;
+    }
+
+    inline std::vector<Result> run_all()
+    {
+        const std::vector<Mix> mixes{
+            { "only D1", { 0.0, 1.0, 0.0 } },
+            { "90/5/5", { 0.9, 0.05, 0.05 } },
+            { "D1/D2 50/50", { 0.0, 0.5, 0.5 } },
+            { "1/3 each", { 1.0, 1.0, 1.0 } },
+        };
+
+        std::vector<Result> results{};
+        for (const Mix& mix : mixes)
+            results.push_back(run(mix));
+
+        return results;
+    }
+
+    inline void print_table(const std::vector<Result>& results, std::ostream& out = std::cout)
+    {
+        const std::ios_base::fmtflags flags{ out.flags() };
+        const std::streamsize precision{ out.precision() };
+
+        out << "nanoseconds per object\n";
+        out << std::left << std::setw(14) << "mix" << std::right;
+        for (const std::string& name : mechanisms())
+            out << std::setw(14) << name;
+        out << std::setw(11) << "checksum" << '\n';
+
+        out << std::fixed << std::setprecision(3);
+
+        for (const Result& result : results)
+        {
+            out << std::left << std::setw(14) << result.mix << std::right;
+            for (double ns : result.ns_per_object)
+                out << std::setw(14) << ns;
+            out << std::setw(11) << (result.checksums_match ? "ok" : "DIFFERS") << '\n';
+        }
+
+        out.flags(flags);
+        out.precision(precision);
+    }
+}
+
+#endif /* DispatchBenchmark_h */
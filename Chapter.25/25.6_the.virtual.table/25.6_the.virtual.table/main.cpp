@@ -48,6 +48,11 @@
  */
 
 #include <iostream>
+#include <string_view>
+#include <variant>
+#include <vector>
+#include "Dispatch.h"
+#include "DispatchBenchmark.h"
 
 /*--------------------------------------------------------------------------------------------------------*/
 /// compiler will set 3 virtual table, one for each class
@@ -75,8 +80,15 @@ public:
 };
 /*--------------------------------------------------------------------------------------------------------*/
 
-int main()
+/// run with --benchmark to compare virtual calls with the other ways in Dispatch.h
+int main(int argc, char* argv[])
 {
+    if (argc > 1 && std::string_view{ argv[1] } == "--benchmark")
+    {
+        DispatchBenchmark::print_table(DispatchBenchmark::run_all());
+        return 0;
+    }
+    
     /// object of Base type is created, hidden pointer *__vptr is set to point to the virtual table for Base
     /// Virtual table for Base objects is simple:
     /// Base can only access its own members, it cannot access the D1 and D2 member functions
@@ -110,5 +122,21 @@ int main()
     Base* b_ptr{ &b };
     b_ptr->func1();
     
+    /// the same kind of objects without virtual functions
+    /// a variant holds any one of the types, std::visit calls the version for the type it holds
+    std::vector<Dispatch::Static::Object> objects{ Dispatch::Static::Plain{ 10 }, Dispatch::Static::D1{ 10 }, Dispatch::Static::D2{ 10 } };
+    
+    for (const auto& object : objects)
+        std::cout << std::visit([](const auto& o) { return o.func1(3); }, object) << ' ';
+    std::cout << '\n';
+    
+    /// grouped by type : every D1 is called in one loop, then every D2, ...
+    Dispatch::TypeGroups<Dispatch::Static::Plain, Dispatch::Static::D1, Dispatch::Static::D2> groups{};
+    for (const auto& object : objects)
+        groups.push_back(object);
+    
+    groups.for_each([](const auto& o) { std::cout << o.func2(3) << ' '; });
+    std::cout << '\n';
+    
     return 0;
 }
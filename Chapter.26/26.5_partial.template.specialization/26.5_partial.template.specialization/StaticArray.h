@@ -0,0 +1,276 @@
+//
+//  StaticArray.h
+//  26.5_partial.template.specialization
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef StaticArray_h
+#define StaticArray_h
+
+#include <type_traits>
+#include <utility>
+
+/*
+ EXPRESSION TEMPLATES:
+
+ With ordinary operator overloading, a + b * c first builds a temporary array for b * c, then
+ another one for a + (b * c), every operator is a separate loop over memory
+
+ Here operator+ and operator* don't compute anything, they return small objects describing the
+ calculation (an expression), the expression is only evaluated when it is assigned to a
+ StaticArray or reduced with sum()/min()/max()/dot(), element by element, in a single loop:
+
+            result[i] = a[i] + b[i] * c[i]
+
+ The size is a template argument, so mismatched sizes are a compile error, and small arrays
+ are unrolled completely at compile time
+ */
+
+/// every array or expression derives from this, E is the derived type (CRTP)
+/// E must provide operator[](int) const, value_type and a static constexpr int length
+template <class E>
+struct ArrayExpression
+{
+    const E& self() const { return static_cast<const E&>(*this); }
+};
+
+template <class T, int size>
+class StaticArray;
+
+namespace ArrayExpressionDetail
+{
+    /// arrays are held by reference, expression nodes are small temporaries and are held by value
+    template <class E>
+    struct Storage { using type = const E; };
+
+    template <class T, int size>
+    struct Storage<StaticArray<T, size>> { using type = const StaticArray<T, size>&; };
+
+    /// arrays up to this length are evaluated with a fully unrolled sequence of statements
+    constexpr int s_unroll_limit{ 16 };
+
+    template <class F, int... indices>
+    void unrolled(F&& function, std::integer_sequence<int, indices...>)
+    {
+        (function(indices), ...);
+    }
+
+    /// calls function(i) for every i in [0, length)
+    template <int length, class F>
+    void for_each_index(F&& function)
+    {
+        if constexpr (length <= s_unroll_limit)
+            unrolled(function, std::make_integer_sequence<int, length>{});
+        else
+            for (int i{ 0 }; i < length; ++i)
+                function(i);
+    }
+
+    struct Add { template <class A, class B> static auto apply(const A& a, const B& b) { return a + b; } };
+    struct Subtract { template <class A, class B> static auto apply(const A& a, const B& b) { return a - b; } };
+    struct Multiply { template <class A, class B> static auto apply(const A& a, const B& b) { return a * b; } };
+    struct Divide { template <class A, class B> static auto apply(const A& a, const B& b) { return a / b; } };
+}
+
+/// an element-wise operation on two expressions of the same length
+template <class L, class R, class Op>
+class BinaryExpression : public ArrayExpression<BinaryExpression<L, R, Op>>
+{
+    static_assert(L::length == R::length, "element-wise operations need arrays of the same size");
+
+private:
+    typename ArrayExpressionDetail::Storage<L>::type m_left;
+    typename ArrayExpressionDetail::Storage<R>::type m_right;
+
+public:
+    using value_type = decltype(Op::apply(std::declval<typename L::value_type>(), std::declval<typename R::value_type>()));
+    static constexpr int length{ L::length };
+
+    BinaryExpression(const L& left, const R& right) : m_left{ left }, m_right{ right }
+    {
+    }
+
+    value_type operator[](int index) const { return Op::apply(m_left[index], m_right[index]); }
+};
+
+/// a single value that looks like an array of any length, used for a + 2, 3 * a, ...
+template <class T, int size>
+class ScalarExpression : public ArrayExpression<ScalarExpression<T, size>>
+{
+private:
+    T m_value{};
+
+public:
+    using value_type = T;
+    static constexpr int length{ size };
+
+    explicit ScalarExpression(const T& value) : m_value{ value }
+    {
+    }
+
+    value_type operator[](int) const { return m_value; }
+};
+
+/// T - template type parameter
+/// size - expression parameter/non-type parameter
+template <class T, int size>
+class StaticArray : public ArrayExpression<StaticArray<T, size>>
+{
+private:
+    T m_array[size] {};
+
+public:
+    using value_type = T;
+    static constexpr int length{ size };
+
+    StaticArray() = default;
+
+    /// evaluates the whole expression in one pass, no temporary arrays are created
+    template <class E>
+    StaticArray(const ArrayExpression<E>& expression)
+    {
+        assign(expression.self());
+    }
+
+    template <class E>
+    StaticArray& operator=(const ArrayExpression<E>& expression)
+    {
+        assign(expression.self());
+        return *this;
+    }
+
+    T* get_array() { return m_array; }
+
+    T& operator[](int index)
+    {
+        return m_array[index];
+    }
+
+    const T& operator[](int index) const
+    {
+        return m_array[index];
+    }
+
+private:
+    template <class E>
+    void assign(const E& expression)
+    {
+        static_assert(E::length == size, "can't assign an expression of a different size");
+
+        /// a = a + b is safe, element i is read before it is written and nothing else reads it later
+        ArrayExpressionDetail::for_each_index<size>([&](int i) { m_array[i] = static_cast<T>(expression[i]); });
+    }
+};
+
+/// array op array
+template <class L, class R>
+BinaryExpression<L, R, ArrayExpressionDetail::Add> operator+(const ArrayExpression<L>& left, const ArrayExpression<R>& right)
+{
+    return { left.self(), right.self() };
+}
+
+template <class L, class R>
+BinaryExpression<L, R, ArrayExpressionDetail::Subtract> operator-(const ArrayExpression<L>& left, const ArrayExpression<R>& right)
+{
+    return { left.self(), right.self() };
+}
+
+template <class L, class R>
+BinaryExpression<L, R, ArrayExpressionDetail::Multiply> operator*(const ArrayExpression<L>& left, const ArrayExpression<R>& right)
+{
+    return { left.self(), right.self() };
+}
+
+template <class L, class R>
+BinaryExpression<L, R, ArrayExpressionDetail::Divide> operator/(const ArrayExpression<L>& left, const ArrayExpression<R>& right)
+{
+    return { left.self(), right.self() };
+}
+
+/// array op scalar and scalar op array, the scalar is broadcast to every element
+/// only arithmetic types count as scalars, so these never compete with the overloads above
+#define STATIC_ARRAY_SCALAR_OPERATOR(symbol, Op)                                                        \
+    template <class E, class S, class = std::enable_if_t<std::is_arithmetic_v<S>>>                      \
+    BinaryExpression<E, ScalarExpression<S, E::length>, ArrayExpressionDetail::Op>                      \
+    operator symbol(const ArrayExpression<E>& left, const S& right)                                     \
+    {                                                                                                   \
+        return { left.self(), ScalarExpression<S, E::length>{ right } };                                \
+    }                                                                                                   \
+                                                                                                        \
+    template <class S, class E, class = std::enable_if_t<std::is_arithmetic_v<S>>>                      \
+    BinaryExpression<ScalarExpression<S, E::length>, E, ArrayExpressionDetail::Op>                      \
+    operator symbol(const S& left, const ArrayExpression<E>& right)                                     \
+    {                                                                                                   \
+        return { ScalarExpression<S, E::length>{ left }, right.self() };                                \
+    }
+
+STATIC_ARRAY_SCALAR_OPERATOR(+, Add)
+STATIC_ARRAY_SCALAR_OPERATOR(-, Subtract)
+STATIC_ARRAY_SCALAR_OPERATOR(*, Multiply)
+STATIC_ARRAY_SCALAR_OPERATOR(/, Divide)
+
+#undef STATIC_ARRAY_SCALAR_OPERATOR
+
+/// REDUCTIONS: evaluate the expression and fold it into one value in the same pass
+
+template <class E>
+typename E::value_type sum(const ArrayExpression<E>& expression)
+{
+    const E& e{ expression.self() };
+    using T = typename E::value_type;
+
+    /// four independent partial sums, so the additions don't all wait on one another
+    T partial[4]{};
+    constexpr int blocked{ E::length - E::length % 4 };
+
+    for (int i{ 0 }; i < blocked; i += 4)
+    {
+        partial[0] += e[i];
+        partial[1] += e[i + 1];
+        partial[2] += e[i + 2];
+        partial[3] += e[i + 3];
+    }
+
+    for (int i{ blocked }; i < E::length; ++i)
+        partial[0] += e[i];
+
+    return (partial[0] + partial[1]) + (partial[2] + partial[3]);
+}
+
+template <class E>
+typename E::value_type min(const ArrayExpression<E>& expression)
+{
+    static_assert(E::length > 0, "min() of an empty array");
+
+    const E& e{ expression.self() };
+    typename E::value_type result{ e[0] };
+
+    for (int i{ 1 }; i < E::length; ++i)
+        result = (e[i] < result) ? e[i] : result;
+
+    return result;
+}
+
+template <class E>
+typename E::value_type max(const ArrayExpression<E>& expression)
+{
+    static_assert(E::length > 0, "max() of an empty array");
+
+    const E& e{ expression.self() };
+    typename E::value_type result{ e[0] };
+
+    for (int i{ 1 }; i < E::length; ++i)
+        result = (result < e[i]) ? e[i] : result;
+
+    return result;
+}
+
+/// dot product, the products are never stored
+template <class L, class R>
+auto dot(const ArrayExpression<L>& left, const ArrayExpression<R>& right)
+{
+    return sum(left * right);
+}
+
+#endif /* StaticArray_h */
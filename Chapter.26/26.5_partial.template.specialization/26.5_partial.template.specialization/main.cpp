@@ -22,27 +22,21 @@
  
  Function can't be partially specialized, one way it to partially specialize the entire class
  
+ -----------------------------------------------------------------------------------------------------------
+ ELEMENT-WISE ARITHMETIC ON StaticArray:
+ 
+ StaticArray is now defined in StaticArray.h, along with +, -, *, / between arrays, between an array and a
+ scalar, and the reductions sum(), min(), max() and dot()
+ 
+ The operators are expression templates, a + b * c doesn't create any temporary array, it is computed in
+ one loop when it is assigned to a StaticArray or passed to a reduction
+ 
  -----------------------------------------------------------------------------------------------------------
  */
 
+#include <cstring>
 #include <iostream>
-
-/// T - template type parameter
-/// size - expression parameter/non-type parameter
-template <class T, int size>
-class StaticArray
-{
-private:
-    T m_array[size] {};
-    
-public:
-    T* get_array() { return m_array; }
-    
-    T& operator[](int index)
-    {
-        return m_array[index];
-    }
-};
+#include "StaticArray.h"
 
 /// this will print the c-style string with spaces - not expected
 template <class T, int size>
@@ -253,5 +247,32 @@ int main()
     
     double4_derived.print();
     
+    StaticArray<double, 4> a{};
+    StaticArray<double, 4> b{};
+    StaticArray<double, 4> c{};
+    
+    for (int i{ 0 }; i < 4; ++i)
+    {
+        a[i] = i + 1.0;
+        b[i] = 2.0;
+        c[i] = 10.0 * i;
+    }
+    
+    /// evaluated as result[i] = a[i] + b[i] * c[i], one loop, no temporaries
+    StaticArray<double, 4> result{ a + b * c };
+    print(result);
+    
+    /// the scalar is used for every element
+    result = (result - 1.0) / 2.0;
+    print(result);
+    
+    std::cout << "sum: " << sum(result) << " min: " << min(a) << " max: " << max(c) << '\n';
+    
+    /// products are summed as they are computed, never stored
+    std::cout << "dot: " << dot(a, c) << '\n';
+    
+    /// won't compile - size 4 and size 6 can't be combined
+    /*StaticArray<double, 6> d{}; a + d;*/
+    
     return 0;
 }
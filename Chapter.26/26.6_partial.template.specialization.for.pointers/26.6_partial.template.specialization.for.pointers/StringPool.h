@@ -0,0 +1,172 @@
+//
+//  StringPool.h
+//  26.6_partial.template.specialization.for.pointers
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef StringPool_h
+#define StringPool_h
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/// string interning pool
+/// every distinct string is stored exactly once, packed one after another into large blocks
+/// (a bump arena: allocating is just moving a pointer forward), so storing a string doesn't
+/// call new for every string
+/// equal strings get the same id and the same address, so two interned strings can be compared
+/// by comparing pointers instead of characters
+/// blocks are never moved, views and pointers stay valid until clear() frees all of them at once
+class StringPool
+{
+public:
+    using Id = std::uint32_t;
+
+private:
+    static constexpr std::size_t s_block_size{ 64 * 1024 };
+    static constexpr std::uint32_t s_empty_slot{ 0 };
+
+    std::vector<std::unique_ptr<char[]>> m_blocks{};
+    char* m_next{};
+    std::size_t m_remaining{};
+    std::size_t m_bytes_used{};
+
+    /// m_strings[id] is the interned string, m_hashes[id] its hash
+    std::vector<std::string_view> m_strings{};
+    std::vector<std::size_t> m_hashes{};
+
+    /// open addressing hash table, each slot holds (id + 1) or s_empty_slot
+    /// size is a power of two and kept at most half full
+    std::vector<std::uint32_t> m_slots{};
+
+    static std::size_t hash(std::string_view text)
+    {
+        return std::hash<std::string_view>{}(text);
+    }
+
+    /// copies the characters (plus a terminating '\0') into the arena
+    const char* allocate(std::string_view text)
+    {
+        const std::size_t needed{ text.size() + 1 };
+
+        if (needed > m_remaining)
+        {
+            /// a string larger than a block gets a block of its own
+            const std::size_t size{ needed > s_block_size ? needed : s_block_size };
+            m_blocks.push_back(std::make_unique<char[]>(size));
+            m_next = m_blocks.back().get();
+            m_remaining = size;
+        }
+
+        char* copy{ m_next };
+        std::memcpy(copy, text.data(), text.size());
+        copy[text.size()] = '\0';
+
+        m_next += needed;
+        m_remaining -= needed;
+        m_bytes_used += needed;
+
+        return copy;
+    }
+
+    void grow_table()
+    {
+        std::vector<std::uint32_t> slots(m_slots.empty() ? 1024 : m_slots.size() * 2, s_empty_slot);
+        const std::size_t mask{ slots.size() - 1 };
+
+        /// the hashes are remembered, so rehashing doesn't touch the strings
+        for (std::size_t id{ 0 }; id < m_strings.size(); ++id)
+        {
+            std::size_t index{ m_hashes[id] & mask };
+            while (slots[index] != s_empty_slot)
+                index = (index + 1) & mask;
+
+            slots[index] = static_cast<std::uint32_t>(id + 1);
+        }
+
+        m_slots = std::move(slots);
+    }
+
+public:
+    StringPool() = default;
+
+    /// the views handed out point into this pool's blocks, so a pool can't be copied
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    /// returns the id of the string, storing it first if it hasn't been seen before
+    Id intern(std::string_view text)
+    {
+        if ((m_strings.size() + 1) * 2 > m_slots.size())
+            grow_table();
+
+        const std::size_t text_hash{ hash(text) };
+        const std::size_t mask{ m_slots.size() - 1 };
+        std::size_t index{ text_hash & mask };
+
+        while (m_slots[index] != s_empty_slot)
+        {
+            const Id id{ m_slots[index] - 1 };
+
+            /// comparing the full hash first skips almost all of the character comparisons
+            if (m_hashes[id] == text_hash && m_strings[id] == text)
+                return id;
+
+            index = (index + 1) & mask;
+        }
+
+        const Id id{ static_cast<Id>(m_strings.size()) };
+        m_strings.emplace_back(allocate(text), text.size());
+        m_hashes.push_back(text_hash);
+        m_slots[index] = id + 1;
+
+        return id;
+    }
+
+    /// interns the string and returns its stable, null terminated copy
+    const char* intern_c_str(std::string_view text)
+    {
+        return m_strings[intern(text)].data();
+    }
+
+    std::string_view view(Id id) const
+    {
+        assert(id < m_strings.size());
+        return m_strings[id];
+    }
+
+    const char* c_str(Id id) const
+    {
+        assert(id < m_strings.size());
+        return m_strings[id].data();
+    }
+
+    /// frees every string in one go, all ids, views and pointers from this pool become invalid
+    void clear()
+    {
+        m_blocks.clear();
+        m_next = nullptr;
+        m_remaining = 0;
+        m_bytes_used = 0;
+
+        m_strings.clear();
+        m_hashes.clear();
+        m_slots.clear();
+    }
+
+    /// number of distinct strings
+    std::size_t size() const { return m_strings.size(); }
+
+    /// characters stored, including the terminating '\0's
+    std::size_t bytes_used() const { return m_bytes_used; }
+    std::size_t block_count() const { return m_blocks.size(); }
+};
+
+#endif /* StringPool_h */
@@ -7,9 +7,20 @@
 
 /*
  Full template specialization: forces us to fully resolve template types
+ 
+ Storage<char*>: copying every string with new char[length] costs one heap allocation per
+ string, and storing the same text a million times stores a million copies
+ 
+ String interning: every distinct string is stored only once in a StringPool, all the
+ Storage<char*> objects holding the same text point at the same copy
+ 
+ - the pool packs the strings next to each other in large blocks, no allocation per string
+ - equal strings have equal pointers, so comparing them is a pointer comparison
+ - the pool frees all the strings at once, individual objects don't delete anything
  */
 
 #include <iostream>
+#include "StringPool.h"
 
 /// template class that works with any types
 template <class T>
@@ -59,32 +70,37 @@ template <>
 class Storage<char*>
 {
 private:
-    char* m_value{};
+    /// one pool shared by all Storage<char*> objects
+    inline static StringPool s_pool{};
+    
+    /// points into s_pool, not owned by this object
+    const char* m_value{};
     
 public:
     /// fully specialising the constructor for char*
-    Storage(char* value)
+    /// the text is copied into the pool only if the pool doesn't have it already
+    Storage(char* value) : m_value{ s_pool.intern_c_str(value) }
     {
-        int length{ 0 };
-        while (value[length] != '\0')
-            ++length;
-        ++length;
-        
-        m_value = new char[length];
-        
-        for (int count{ 0 }; count < length; ++count)
-            m_value[count] = value[count];
     }
     
-    /// fully specialising the constructor for char*
-    ~Storage() { delete[] m_value; }
-    
+    /// fully specialising the destructor for char*
+    /// nothing to delete, the pool owns the characters
+    ~Storage() {}
     
     /// fully specialising the print function for char*
     void print() const
     {
         std::cout << m_value;
     }
+    
+    /// interned strings with the same text share the same address
+    friend bool operator==(const Storage& a, const Storage& b) { return a.m_value == b.m_value; }
+    friend bool operator!=(const Storage& a, const Storage& b) { return a.m_value != b.m_value; }
+    
+    static std::size_t pool_size() { return s_pool.size(); }
+    
+    /// frees every stored string at once, only call this once no Storage<char*> object is left
+    static void release_all() { s_pool.clear(); }
 };
 
 /*--------------------------------------------------------------------------------------------------------*/
@@ -158,5 +174,23 @@ int main()
     
     my_name.print();
     
+    char* same_name{ new char[40] { "Leon\n" } };
+    char* other_name{ new char[40] { "Judah\n" } };
+    
+    {
+        Storage<char*> my_name_again{ same_name };
+        Storage<char*> my_other_name{ other_name };
+        
+        /// same text, so both objects share one copy in the pool, compared by pointer
+        std::cout << std::boolalpha << (my_name == my_name_again) << '\n';
+        std::cout << (my_name == my_other_name) << '\n';
+        
+        /// 2 distinct strings stored, for 3 objects
+        std::cout << "Strings in pool: " << Storage<char*>::pool_size() << '\n';
+    }
+    
+    delete[] same_name;
+    delete[] other_name;
+    
     return 0;
 }
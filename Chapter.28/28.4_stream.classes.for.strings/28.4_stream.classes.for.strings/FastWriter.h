@@ -0,0 +1,238 @@
+//
+//  FastWriter.h
+//  28.4_stream.classes.for.strings
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef FastWriter_h
+#define FastWriter_h
+
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include <unistd.h>
+
+/// Output buffer for building text quickly, a lightweight replacement for std::stringstream
+/// - the buffer is a plain array inside the object (on the stack for a local FastWriter), nothing
+///   is allocated unless the text is flushed into a std::string
+/// - numbers are converted with std::to_chars: no locale, no virtual functions, no stream state
+/// - when the buffer fills up it is flushed to the sink, a file descriptor or a std::string
+/// - clear() empties the buffer so the same writer can be reused for the next piece of text
+template <std::size_t Capacity = 4096>
+class FastWriter
+{
+    static_assert(Capacity >= 64, "FastWriter needs room for at least one converted number");
+
+public:
+    /// where the text goes when the buffer is full, or when flush() is called
+    enum class Sink
+    {
+        none,           /// text stays in the buffer, anything that doesn't fit is dropped
+        descriptor,     /// written to a file descriptor, e.g. STDOUT_FILENO
+        string,         /// appended to a std::string
+    };
+
+private:
+    char m_buffer[Capacity];
+    std::size_t m_length{ 0 };
+
+    Sink m_sink{ Sink::none };
+    int m_descriptor{ -1 };
+    std::string* m_string{ nullptr };
+    bool m_overflowed{ false };
+
+    std::size_t space() const { return Capacity - m_length; }
+
+    /// makes sure there is room for needed more characters, returns false if there isn't
+    bool reserve(std::size_t needed)
+    {
+        if (needed <= space())
+            return true;
+
+        flush();
+
+        if (needed <= space())
+            return true;
+
+        m_overflowed = true;
+        return false;
+    }
+
+    void write_out(const char* data, std::size_t length)
+    {
+        if (m_sink == Sink::string)
+            m_string->append(data, length);
+        else if (m_sink == Sink::descriptor)
+        {
+            /// write() may accept fewer bytes than asked for, keep going until everything is written
+            while (length > 0)
+            {
+                const ssize_t written{ ::write(m_descriptor, data, length) };
+                if (written <= 0)
+                {
+                    m_overflowed = true;
+                    return;
+                }
+
+                data += written;
+                length -= static_cast<std::size_t>(written);
+            }
+        }
+    }
+
+public:
+    /// text is only kept in the buffer
+    FastWriter() = default;
+
+    /// text is written to a file descriptor
+    explicit FastWriter(int descriptor) : m_sink{ Sink::descriptor }, m_descriptor{ descriptor }
+    {
+    }
+
+    /// text is appended to a string
+    explicit FastWriter(std::string& target) : m_sink{ Sink::string }, m_string{ &target }
+    {
+    }
+
+    FastWriter(const FastWriter&) = delete;
+    FastWriter& operator=(const FastWriter&) = delete;
+
+    ~FastWriter()
+    {
+        flush();
+    }
+
+    FastWriter& append(std::string_view text)
+    {
+        if (text.size() <= space())
+        {
+            std::memcpy(m_buffer + m_length, text.data(), text.size());
+            m_length += text.size();
+            return *this;
+        }
+
+        /// too long for the buffer: flush what we have, then hand the text straight to the sink
+        flush();
+
+        if (m_sink == Sink::none || text.size() <= space())
+        {
+            const std::size_t length{ text.size() <= space() ? text.size() : space() };
+            std::memcpy(m_buffer + m_length, text.data(), length);
+            m_length += length;
+            m_overflowed = m_overflowed || length < text.size();
+        }
+        else
+            write_out(text.data(), text.size());
+
+        return *this;
+    }
+
+    FastWriter& append(const char* text) { return append(std::string_view{ text }); }
+    FastWriter& append(const std::string& text) { return append(std::string_view{ text }); }
+
+    FastWriter& append(char ch)
+    {
+        if (reserve(1))
+            m_buffer[m_length++] = ch;
+
+        return *this;
+    }
+
+    /// all integer types, bool and char are handled by the overloads above and below
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>>>
+    FastWriter& append(T value)
+    {
+        /// 20 digits for the largest 64-bit value, plus a sign
+        if (reserve(21))
+            m_length = static_cast<std::size_t>(std::to_chars(m_buffer + m_length, m_buffer + Capacity, value).ptr - m_buffer);
+
+        return *this;
+    }
+
+    FastWriter& append(bool value) { return append(value ? std::string_view{ "true" } : std::string_view{ "false" }); }
+
+    /// shortest text that converts back to exactly the same double
+    FastWriter& append(double value)
+    {
+        if (!reserve(32))
+            return *this;
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        m_length = static_cast<std::size_t>(std::to_chars(m_buffer + m_length, m_buffer + Capacity, value).ptr - m_buffer);
+#else
+        /// older standard libraries only convert integers with std::to_chars, %.17g also
+        /// round-trips, though not always with the fewest digits
+        const int written{ std::snprintf(m_buffer + m_length, space(), "%.17g", value) };
+        if (written > 0)
+            m_length += static_cast<std::size_t>(written);
+#endif
+
+        return *this;
+    }
+
+    /// fixed number of digits after the decimal point, like std::fixed << std::setprecision(precision)
+    FastWriter& append_fixed(double value, int precision)
+    {
+        if (!reserve(64))
+            return *this;
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        const std::to_chars_result result{ std::to_chars(m_buffer + m_length, m_buffer + Capacity, value, std::chars_format::fixed, precision) };
+        if (result.ec == std::errc{})
+            m_length = static_cast<std::size_t>(result.ptr - m_buffer);
+        else
+            m_overflowed = true;
+#else
+        const int written{ std::snprintf(m_buffer + m_length, space(), "%.*f", precision, value) };
+        if (written > 0 && static_cast<std::size_t>(written) < space())
+            m_length += static_cast<std::size_t>(written);
+        else
+            m_overflowed = true;
+#endif
+
+        return *this;
+    }
+
+    FastWriter& append(float value) { return append(static_cast<double>(value)); }
+
+    /// chaining, like a stream: writer << "x = " << x << '\n';
+    template <typename T>
+    FastWriter& operator<<(const T& value) { return append(value); }
+
+    /// hands the buffered text to the sink and empties the buffer
+    /// with Sink::none there is nowhere to send it, so the text stays in the buffer
+    void flush()
+    {
+        if (m_sink == Sink::none || m_length == 0)
+            return;
+
+        write_out(m_buffer, m_length);
+        m_length = 0;
+    }
+
+    /// empties the buffer without sending it anywhere, so the writer can be reused
+    void clear()
+    {
+        m_length = 0;
+        m_overflowed = false;
+    }
+
+    /// text currently in the buffer, valid until the next append, flush or clear
+    std::string_view view() const { return { m_buffer, m_length }; }
+    std::string str() const { return std::string{ view() }; }
+
+    std::size_t size() const { return m_length; }
+    static constexpr std::size_t capacity() { return Capacity; }
+
+    /// true if some text was dropped, because it didn't fit or couldn't be written
+    bool overflowed() const { return m_overflowed; }
+};
+
+#endif /* FastWriter_h */
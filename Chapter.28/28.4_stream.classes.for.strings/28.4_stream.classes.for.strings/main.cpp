@@ -43,11 +43,23 @@
  When clearing out a stringstream: it is also a good idea to call the clear() function, clear resets any
  error flags that may have been set and returns the stream back to the OK state
  
+ -----------------------------------------------------------------------------------------------------------
+ Cost of a stringstream: constructing one allocates a buffer and sets up a locale, every << goes through
+ virtual functions and locale aware formatting, for a few conversions that doesn't matter, for millions of
+ short strings the setup costs more than the formatting itself
+ 
+ FastWriter - a fixed size buffer inside the object, numbers converted with std::to_chars(no locale), text
+ is chained with << or append() just like a stream, the result can be taken as a std::string_view, or the
+ writer can flush straight to a file descriptor or append to a std::string when the buffer fills up
+ 
  -----------------------------------------------------------------------------------------------------------
  */
 
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <unistd.h>
+#include "FastWriter.h"
 
 int main()
 {
@@ -126,6 +138,33 @@ int main()
     /// clear resets any error flags that may have been set and returns the stream back to the OK state
     str_to_clear.clear();
     std::cout << str_to_clear.str() << '\n';
+    /*------------------------------------------------------*/
+    
+    /// converting the numbers into text without a stringstream
+    FastWriter<> writer{};
+    writer << my_value << ' ' << my_double;
+    std::cout << writer.view() << '\n';
+    
+    /// clear() makes the same buffer available for the next string
+    writer.clear();
+    writer << "label_" << 42 << '_';
+    writer.append_fixed(3.14159, 2);
+    std::cout << writer.view() << '\n';
+    
+    /// many labels collected in one std::string, the buffer is flushed into it whenever it fills up
+    std::string labels{};
+    {
+        FastWriter<256> label_writer{ labels };
+        
+        for (int count{ 0 }; count < 1000; ++count)
+            label_writer << "item" << count << '\n';
+    }   /// the destructor flushes what is left in the buffer
+    std::cout << labels.size() << " characters of labels\n";
+    
+    /// writing directly to standard output, bypassing std::cout
+    std::cout.flush();
+    FastWriter<> out{ STDOUT_FILENO };
+    out << "written with write(): " << -12345 << ' ' << 0.1 << '\n';
     
     return 0;
 }
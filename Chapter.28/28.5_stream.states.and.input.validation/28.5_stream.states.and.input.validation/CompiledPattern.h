@@ -0,0 +1,185 @@
+//
+//  CompiledPattern.h
+//  28.5_stream.states.and.input.validation
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef CompiledPattern_h
+#define CompiledPattern_h
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/// Pattern for input_matches(), compiled once and reused for every input
+/// Same mask characters as input_matches():
+///     # - a digit
+///     _ - whitespace
+///     @ - a letter
+///     ? - anything
+/// any other character must match exactly
+/// Characters are classified like std::isdigit/std::isspace/std::isalpha in the default "C" locale
+class CompiledPattern
+{
+public:
+    /// one bit per character class
+    enum ClassBits : std::uint8_t
+    {
+        digit_bit = 1 << 0,
+        space_bit = 1 << 1,
+        alpha_bit = 1 << 2,
+        any_bit = 1 << 7,
+    };
+
+private:
+    /// class bits of every possible byte, built once for the whole program
+    static std::array<std::uint8_t, 256> make_class_table()
+    {
+        std::array<std::uint8_t, 256> table{};
+
+        for (int ch{ 0 }; ch < 256; ++ch)
+        {
+            std::uint8_t bits{ any_bit };
+
+            if (ch >= '0' && ch <= '9')
+                bits |= digit_bit;
+            if (ch == ' ' || (ch >= '\t' && ch <= '\r'))
+                bits |= space_bit;
+            if ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z'))
+                bits |= alpha_bit;
+
+            table[static_cast<std::size_t>(ch)] = bits;
+        }
+
+        return table;
+    }
+
+    inline static const std::array<std::uint8_t, 256> s_class_table{ make_class_table() };
+
+    /// for position i: m_classes[i] are the classes accepted there (0 for a literal position),
+    /// m_literal_mask[i] is 0xFF for a literal position and m_literals[i] is the literal
+    std::vector<std::uint8_t> m_classes{};
+    std::vector<std::uint8_t> m_literal_mask{};
+    std::vector<std::uint8_t> m_literals{};
+
+    /// checks positions [first, last) one byte at a time, without branching on the result
+    bool matches_scalar(const unsigned char* input, std::size_t first, std::size_t last) const
+    {
+        unsigned int ok{ 1 };
+
+        for (std::size_t i{ first }; i < last; ++i)
+        {
+            const unsigned char ch{ input[i] };
+            const bool class_hit{ (s_class_table[ch] & m_classes[i]) != 0 };
+            const bool literal_hit{ m_literal_mask[i] != 0 && ch == m_literals[i] };
+
+            ok &= static_cast<unsigned int>(class_hit | literal_hit);
+        }
+
+        return ok != 0;
+    }
+
+#if defined(__SSE2__)
+    /// classifies 16 characters at once with comparisons instead of table lookups
+    static __m128i classify16(__m128i ch)
+    {
+        /// SSE2 only has signed byte comparisons, flipping the top bit turns an unsigned range
+        /// check (ch - low) < count into a signed one
+        const __m128i flip{ _mm_set1_epi8(static_cast<char>(0x80)) };
+
+        auto in_range = [&](__m128i value, char low, char count) {
+            __m128i shifted{ _mm_xor_si128(_mm_sub_epi8(value, _mm_set1_epi8(low)), flip) };
+            return _mm_cmplt_epi8(shifted, _mm_xor_si128(_mm_set1_epi8(count), flip));
+        };
+
+        const __m128i digit{ in_range(ch, '0', 10) };
+        const __m128i alpha{ in_range(_mm_or_si128(ch, _mm_set1_epi8(0x20)), 'a', 26) };
+        const __m128i space{ _mm_or_si128(_mm_cmpeq_epi8(ch, _mm_set1_epi8(' ')), in_range(ch, '\t', 5)) };
+
+        __m128i bits{ _mm_set1_epi8(static_cast<char>(any_bit)) };
+        bits = _mm_or_si128(bits, _mm_and_si128(digit, _mm_set1_epi8(digit_bit)));
+        bits = _mm_or_si128(bits, _mm_and_si128(space, _mm_set1_epi8(space_bit)));
+        bits = _mm_or_si128(bits, _mm_and_si128(alpha, _mm_set1_epi8(alpha_bit)));
+
+        return bits;
+    }
+#endif
+
+public:
+    explicit CompiledPattern(std::string_view pattern)
+        : m_classes(pattern.size()), m_literal_mask(pattern.size()), m_literals(pattern.size())
+    {
+        for (std::size_t i{ 0 }; i < pattern.size(); ++i)
+        {
+            switch (pattern[i])
+            {
+            case '#': m_classes[i] = digit_bit; break;
+            case '_': m_classes[i] = space_bit; break;
+            case '@': m_classes[i] = alpha_bit; break;
+            case '?': m_classes[i] = any_bit; break;
+            default:
+                m_literal_mask[i] = 0xFF;
+                m_literals[i] = static_cast<std::uint8_t>(pattern[i]);
+                break;
+            }
+        }
+    }
+
+    std::size_t length() const { return m_classes.size(); }
+
+    bool matches(std::string_view input) const
+    {
+        if (input.size() != length())
+            return false;
+
+        const unsigned char* data{ reinterpret_cast<const unsigned char*>(input.data()) };
+        std::size_t i{ 0 };
+
+#if defined(__SSE2__)
+        /// 16 positions at a time: a position passes if its class bits overlap the accepted
+        /// classes, or it is a literal position and the bytes are equal
+        for (; i + 16 <= input.size(); i += 16)
+        {
+            const __m128i ch{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)) };
+            const __m128i classes{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_classes.data() + i)) };
+            const __m128i literal_mask{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_literal_mask.data() + i)) };
+            const __m128i literals{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_literals.data() + i)) };
+
+            const __m128i zero{ _mm_setzero_si128() };
+            const __m128i class_miss{ _mm_cmpeq_epi8(_mm_and_si128(classify16(ch), classes), zero) };
+            const __m128i literal_hit{ _mm_and_si128(_mm_cmpeq_epi8(ch, literals), literal_mask) };
+            const __m128i hit{ _mm_or_si128(_mm_andnot_si128(class_miss, _mm_set1_epi8(-1)), literal_hit) };
+
+            if (_mm_movemask_epi8(hit) != 0xFFFF)
+                return false;
+        }
+#endif
+
+        return matches_scalar(data, i, input.size());
+    }
+
+    /// validates every record, bit (i % 64) of word (i / 64) is set if records[i] does NOT match
+    std::vector<std::uint64_t> validate(const std::string_view* records, std::size_t count) const
+    {
+        std::vector<std::uint64_t> failures((count + 63) / 64);
+
+        for (std::size_t i{ 0 }; i < count; ++i)
+            failures[i / 64] |= static_cast<std::uint64_t>(!matches(records[i])) << (i % 64);
+
+        return failures;
+    }
+
+    std::vector<std::uint64_t> validate(const std::vector<std::string_view>& records) const
+    {
+        return validate(records.data(), records.size());
+    }
+};
+
+#endif /* CompiledPattern_h */
@@ -0,0 +1,263 @@
+//
+//  TextKernels.h
+//  28.5_stream.states.and.input.validation
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef TextKernels_h
+#define TextKernels_h
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/// Scanning kernels for ASCII text, they look at 32 bytes at a time with AVX2, 16 with SSE2,
+/// and fall back to one byte at a time on other processors
+/// Classification is plain ASCII, like std::isalpha/std::isdigit/std::isspace in the "C" locale,
+/// no locale is consulted
+namespace TextKernels
+{
+    namespace detail
+    {
+        inline bool is_alpha(unsigned char ch) { return static_cast<unsigned char>((ch | 0x20) - 'a') < 26; }
+        inline bool is_digit(unsigned char ch) { return static_cast<unsigned char>(ch - '0') < 10; }
+        inline bool is_space(unsigned char ch) { return ch == ' ' || static_cast<unsigned char>(ch - '\t') < 5; }
+
+        inline int popcount(std::uint32_t bits) { return __builtin_popcount(bits); }
+        inline int lowest_bit(std::uint32_t bits) { return __builtin_ctz(bits); }
+
+#if defined(__AVX2__) || defined(__SSE2__)
+        /// the few vector operations the kernels need, written once for both instruction sets
+#if defined(__AVX2__)
+        using Block = __m256i;
+        constexpr std::size_t s_width{ 32 };
+
+        inline Block load(const char* p) { return _mm256_loadu_si256(reinterpret_cast<const Block*>(p)); }
+        inline Block load_aligned(const char* p) { return _mm256_load_si256(reinterpret_cast<const Block*>(p)); }
+        inline Block splat(char ch) { return _mm256_set1_epi8(ch); }
+        inline Block equal(Block a, Block b) { return _mm256_cmpeq_epi8(a, b); }
+        inline Block either(Block a, Block b) { return _mm256_or_si256(a, b); }
+        inline Block minus(Block a, Block b) { return _mm256_sub_epi8(a, b); }
+        inline Block flip(Block a, Block b) { return _mm256_xor_si256(a, b); }
+        inline Block less(Block a, Block b) { return _mm256_cmpgt_epi8(b, a); }
+        inline std::uint32_t bits(Block a) { return static_cast<std::uint32_t>(_mm256_movemask_epi8(a)); }
+#else
+        using Block = __m128i;
+        constexpr std::size_t s_width{ 16 };
+
+        inline Block load(const char* p) { return _mm_loadu_si128(reinterpret_cast<const Block*>(p)); }
+        inline Block load_aligned(const char* p) { return _mm_load_si128(reinterpret_cast<const Block*>(p)); }
+        inline Block splat(char ch) { return _mm_set1_epi8(ch); }
+        inline Block equal(Block a, Block b) { return _mm_cmpeq_epi8(a, b); }
+        inline Block either(Block a, Block b) { return _mm_or_si128(a, b); }
+        inline Block minus(Block a, Block b) { return _mm_sub_epi8(a, b); }
+        inline Block flip(Block a, Block b) { return _mm_xor_si128(a, b); }
+        inline Block less(Block a, Block b) { return _mm_cmplt_epi8(a, b); }
+        inline std::uint32_t bits(Block a) { return static_cast<std::uint32_t>(_mm_movemask_epi8(a)); }
+#endif
+
+        constexpr std::uint32_t s_all_bits{ s_width == 32 ? 0xFFFFFFFFu : 0xFFFFu };
+
+        /// true for bytes in [low, low + count), byte comparisons are signed, flipping the top bit
+        /// turns the unsigned range check into a signed one
+        inline Block in_range(Block value, char low, char count)
+        {
+            const Block top{ splat(static_cast<char>(0x80)) };
+            return less(flip(minus(value, splat(low)), top), flip(splat(count), top));
+        }
+
+        inline Block alpha(Block value) { return in_range(either(value, splat(0x20)), 'a', 26); }
+        inline Block digit(Block value) { return in_range(value, '0', 10); }
+        inline Block space(Block value) { return either(equal(value, splat(' ')), in_range(value, '\t', 5)); }
+#endif
+
+        /// runs a whole-block test over the text, then the per-byte test over the leftover bytes
+        template <class BlockTest, class ByteTest>
+        bool all_of(std::string_view text, BlockTest block_test, ByteTest byte_test)
+        {
+            std::size_t i{ 0 };
+
+#if defined(__AVX2__) || defined(__SSE2__)
+            for (; i + s_width <= text.size(); i += s_width)
+                if (bits(block_test(load(text.data() + i))) != s_all_bits)
+                    return false;
+#else
+            (void)block_test;
+#endif
+
+            for (; i < text.size(); ++i)
+                if (!byte_test(static_cast<unsigned char>(text[i])))
+                    return false;
+
+            return true;
+        }
+    }
+
+    /// VALIDATION: true if every character is in the class, also true for an empty string
+
+    inline bool is_all_alpha(std::string_view text)
+    {
+#if defined(__AVX2__) || defined(__SSE2__)
+        return detail::all_of(text, [](detail::Block b) { return detail::alpha(b); }, detail::is_alpha);
+#else
+        return detail::all_of(text, nullptr, detail::is_alpha);
+#endif
+    }
+
+    inline bool is_all_digit(std::string_view text)
+    {
+#if defined(__AVX2__) || defined(__SSE2__)
+        return detail::all_of(text, [](detail::Block b) { return detail::digit(b); }, detail::is_digit);
+#else
+        return detail::all_of(text, nullptr, detail::is_digit);
+#endif
+    }
+
+    inline bool is_all_space(std::string_view text)
+    {
+#if defined(__AVX2__) || defined(__SSE2__)
+        return detail::all_of(text, [](detail::Block b) { return detail::space(b); }, detail::is_space);
+#else
+        return detail::all_of(text, nullptr, detail::is_space);
+#endif
+    }
+
+    /// letters and whitespace only, the rule used by is_valid_name()
+    inline bool is_all_alpha_or_space(std::string_view text)
+    {
+        auto byte_test = [](unsigned char ch) { return detail::is_alpha(ch) || detail::is_space(ch); };
+
+#if defined(__AVX2__) || defined(__SSE2__)
+        return detail::all_of(text, [](detail::Block b) { return detail::either(detail::alpha(b), detail::space(b)); }, byte_test);
+#else
+        return detail::all_of(text, nullptr, byte_test);
+#endif
+    }
+
+    /// number of times byte occurs in text
+    inline std::size_t count(std::string_view text, char byte)
+    {
+        std::size_t total{ 0 };
+        std::size_t i{ 0 };
+
+#if defined(__AVX2__) || defined(__SSE2__)
+        const detail::Block wanted{ detail::splat(byte) };
+
+        for (; i + detail::s_width <= text.size(); i += detail::s_width)
+            total += static_cast<std::size_t>(detail::popcount(detail::bits(detail::equal(detail::load(text.data() + i), wanted))));
+#endif
+
+        for (; i < text.size(); ++i)
+            total += (text[i] == byte);
+
+        return total;
+    }
+
+    /// index of the first character of text that is one of the characters in set, or
+    /// std::string_view::npos, like std::string_view::find_first_of()
+    inline std::size_t find_first_of(std::string_view text, std::string_view set)
+    {
+        std::size_t i{ 0 };
+
+#if defined(__AVX2__) || defined(__SSE2__)
+        /// one comparison per character in the set, meant for small sets like " \t,;"
+        if (!set.empty() && set.size() <= 16)
+        {
+            detail::Block splats[16]{};
+            for (std::size_t s{ 0 }; s < set.size(); ++s)
+                splats[s] = detail::splat(set[s]);
+
+            for (; i + detail::s_width <= text.size(); i += detail::s_width)
+            {
+                const detail::Block block{ detail::load(text.data() + i) };
+                detail::Block hits{ detail::equal(block, splats[0]) };
+
+                for (std::size_t s{ 1 }; s < set.size(); ++s)
+                    hits = detail::either(hits, detail::equal(block, splats[s]));
+
+                if (const std::uint32_t mask{ detail::bits(hits) })
+                    return i + static_cast<std::size_t>(detail::lowest_bit(mask));
+            }
+        }
+#endif
+
+        /// a 256 entry table makes the membership test a single lookup
+        bool in_set[256]{};
+        for (char ch : set)
+            in_set[static_cast<unsigned char>(ch)] = true;
+
+        for (; i < text.size(); ++i)
+            if (in_set[static_cast<unsigned char>(text[i])])
+                return i;
+
+        return std::string_view::npos;
+    }
+
+    struct LengthAndCount
+    {
+        std::size_t length{};
+        std::size_t count{};
+    };
+
+    /// strlen() and count() in one pass over a null terminated string
+    /// the vector version reads whole aligned blocks, so it may read a few bytes past the
+    /// terminator, but never past the aligned block holding it, which can't cross into another
+    /// memory page (the same trick optimized strlen() implementations use)
+#if defined(__clang__) || defined(__GNUC__)
+    __attribute__((no_sanitize_address))
+#endif
+    inline LengthAndCount length_and_count(const char* string, char byte)
+    {
+        LengthAndCount result{};
+
+#if defined(__AVX2__) || defined(__SSE2__)
+        const detail::Block zero{ detail::splat('\0') };
+        const detail::Block wanted{ detail::splat(byte) };
+
+        const std::uintptr_t address{ reinterpret_cast<std::uintptr_t>(string) };
+        const char* block_start{ reinterpret_cast<const char*>(address & ~static_cast<std::uintptr_t>(detail::s_width - 1)) };
+
+        /// bytes of the first block that come before the string are ignored
+        std::uint32_t skip{ static_cast<std::uint32_t>(address - reinterpret_cast<std::uintptr_t>(block_start)) };
+
+        for (;; block_start += detail::s_width, skip = 0)
+        {
+            const detail::Block block{ detail::load_aligned(block_start) };
+            const std::uint32_t ignore{ (std::uint32_t{ 1 } << skip) - 1 };
+
+            const std::uint32_t zeros{ detail::bits(detail::equal(block, zero)) & ~ignore };
+            std::uint32_t matches{ detail::bits(detail::equal(block, wanted)) & ~ignore };
+
+            if (zeros)
+            {
+                /// only count the matches before the terminator
+                const int end{ detail::lowest_bit(zeros) };
+                matches &= (std::uint32_t{ 1 } << end) - 1;
+
+                result.count += static_cast<std::size_t>(detail::popcount(matches));
+                result.length = static_cast<std::size_t>(block_start + end - string);
+
+                return result;
+            }
+
+            result.count += static_cast<std::size_t>(detail::popcount(matches));
+        }
+#else
+        const char* current{ string };
+        for (; *current != '\0'; ++current)
+            result.count += (*current == byte);
+
+        result.length = static_cast<std::size_t>(current - string);
+        return result;
+#endif
+    }
+}
+
+#endif /* TextKernels_h */
@@ -65,6 +65,18 @@
  Numeric validation as a string: Another way to process numeric input is to read it in as a string, then
  try to convert it to a numeric type.
  
+ -----------------------------------------------------------------------------------------------------------
+ Validating many inputs against the same pattern: input_matches() looks up every mask character in a
+ std::map and calls the classification function through a pointer, for every character of every input
+ 
+ CompiledPattern - turns the pattern into arrays once, every byte is classified by a 256 entry table (or 16
+ bytes at a time with SSE2), and validate() checks a whole batch of records, returning a bitmask with one
+ bit per record that failed
+ 
+ TextKernels - std::isalpha/std::isspace consult the current locale for every character, is_valid_name()
+ only needs ASCII letters and whitespace, TextKernels::is_all_alpha_or_space() checks 16 or 32 characters
+ per step
+ 
  -----------------------------------------------------------------------------------------------------------
  */
 
@@ -78,6 +90,9 @@
 #include <limits>
 #include <charconv>
 #include <optional>
+#include <vector>
+#include "CompiledPattern.h"
+#include "TextKernels.h"
 
 bool is_valid_name(std::string_view name)
 {
@@ -88,10 +103,13 @@ bool is_valid_name(std::string_view name)
     })*/
     
     /// before C++, without ranges
-    return std::all_of(name.begin(), name.end(), [](char ch)
+    /*return std::all_of(name.begin(), name.end(), [](char ch)
     {
         return (std::isalpha(ch) || std::isspace(ch));
-    });
+    });*/
+    
+    /// same check without a locale lookup per character, many characters at a time
+    return TextKernels::is_all_alpha_or_space(name);
 }
 
 /*bool input_matches(std::string_view input, std::string_view pattern)
@@ -169,6 +187,16 @@ int main()
     
     std::cout << "You entered: " << phone_number << '\n';*/
     
+    static const CompiledPattern phone_pattern{ "(###) ###-####" };
+    
+    std::vector<std::string_view> phone_numbers{ "(555) 123-4567", "(555) 12-34567", "555 123 4567", "(800) 555-0199" };
+    
+    /// bit i is set if phone_numbers[i] doesn't match
+    std::uint64_t failures{ phone_pattern.validate(phone_numbers)[0] };
+    
+    for (std::size_t i{ 0 }; i < phone_numbers.size(); ++i)
+        std::cout << phone_numbers[i] << ((failures >> i) & 1 ? " - invalid\n" : " - valid\n");
+    
     int age{};
     
     /*while (true)
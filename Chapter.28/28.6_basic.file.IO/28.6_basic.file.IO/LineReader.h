@@ -0,0 +1,215 @@
+//
+//  LineReader.h
+//  28.6_basic.file.IO
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef LineReader_h
+#define LineReader_h
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// Reads a file line by line without copying each line into a std::string
+/// - a regular file is memory mapped, every line is a std::string_view straight into the mapping
+/// - pipes, terminals and anything else that can't be mapped are read in large page aligned blocks
+/// - the end of a line is found with std::memchr, which the C library implements with vector
+///   instructions, so it checks many bytes per step
+/// - "\n" and "\r\n" line endings are both handled, the line ending is not part of the line
+/// - a final '\n' doesn't produce an extra empty line at the end, unlike while (file) { getline(); }
+/// POSIX only (macOS, Linux)
+class LineReader
+{
+private:
+    static constexpr std::size_t s_page_size{ 4096 };
+    static constexpr std::size_t s_block_size{ 1024 * 1024 };
+
+    int m_descriptor{ -1 };
+    bool m_owns_descriptor{ false };
+
+    /// mapped mode: the whole file
+    const char* m_mapping{};
+    std::size_t m_mapping_size{};
+
+    /// buffered mode: unread bytes are [m_begin, m_end) of m_buffer
+    char* m_buffer{};
+    std::size_t m_capacity{};
+    std::size_t m_begin{};
+    std::size_t m_end{};
+    bool m_end_of_input{ false };
+
+    std::uint64_t m_line_number{ 0 };
+
+    void try_map()
+    {
+        struct stat info{};
+        if (::fstat(m_descriptor, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size <= 0)
+            return;
+
+        void* address{ ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, m_descriptor, 0) };
+        if (address == MAP_FAILED)
+            return;
+
+        ::madvise(address, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+
+        m_mapping = static_cast<const char*>(address);
+        m_mapping_size = static_cast<std::size_t>(info.st_size);
+
+        /// the mapped bytes are read like a buffer that is already full
+        m_begin = 0;
+        m_end = m_mapping_size;
+        m_end_of_input = true;
+    }
+
+    const char* data() const { return m_mapping ? m_mapping : m_buffer; }
+
+    /// buffered mode: moves the unread bytes to the front and reads more after them
+    /// the buffer is doubled if a single line doesn't fit into it
+    bool refill()
+    {
+        if (m_end_of_input)
+            return false;
+
+        if (m_begin > 0)
+        {
+            std::memmove(m_buffer, m_buffer + m_begin, m_end - m_begin);
+            m_end -= m_begin;
+            m_begin = 0;
+        }
+
+        if (m_end == m_capacity && !grow())
+            return false;
+
+        const ssize_t count{ ::read(m_descriptor, m_buffer + m_end, m_capacity - m_end) };
+        if (count <= 0)
+        {
+            m_end_of_input = true;
+            return false;
+        }
+
+        m_end += static_cast<std::size_t>(count);
+        return true;
+    }
+
+    bool grow()
+    {
+        const std::size_t capacity{ m_capacity ? m_capacity * 2 : s_block_size };
+
+        void* buffer{};
+        if (::posix_memalign(&buffer, s_page_size, capacity) != 0)
+            return false;
+
+        if (m_buffer)
+        {
+            std::memcpy(buffer, m_buffer, m_end);
+            std::free(m_buffer);
+        }
+
+        m_buffer = static_cast<char*>(buffer);
+        m_capacity = capacity;
+
+        return true;
+    }
+
+    void open_descriptor()
+    {
+        if (m_descriptor < 0)
+            return;
+
+        try_map();
+
+        if (!m_mapping && !grow())
+            m_end_of_input = true;
+    }
+
+    /// cuts the '\r' off a "\r\n" line ending
+    static std::string_view without_carriage_return(const char* first, std::size_t length)
+    {
+        if (length > 0 && first[length - 1] == '\r')
+            --length;
+
+        return { first, length };
+    }
+
+public:
+    /// opens and reads the named file
+    explicit LineReader(const char* path)
+        : m_descriptor{ ::open(path, O_RDONLY) }, m_owns_descriptor{ true }
+    {
+        open_descriptor();
+    }
+
+    /// reads from an already open descriptor, e.g. STDIN_FILENO, the descriptor is not closed
+    explicit LineReader(int descriptor) : m_descriptor{ descriptor }
+    {
+        open_descriptor();
+    }
+
+    LineReader(const LineReader&) = delete;
+    LineReader& operator=(const LineReader&) = delete;
+
+    ~LineReader()
+    {
+        if (m_mapping)
+            ::munmap(const_cast<char*>(m_mapping), m_mapping_size);
+
+        std::free(m_buffer);
+
+        if (m_owns_descriptor && m_descriptor >= 0)
+            ::close(m_descriptor);
+    }
+
+    bool is_open() const { return m_descriptor >= 0; }
+    bool is_mapped() const { return m_mapping != nullptr; }
+
+    /// number of lines returned so far, the line just returned by next() is line line_number()
+    std::uint64_t line_number() const { return m_line_number; }
+
+    /// reads the next line into line, returns false once there are no more lines
+    /// a mapped file's lines stay valid as long as the reader exists, otherwise a line is only
+    /// valid until the next call to next()
+    bool next(std::string_view& line)
+    {
+        while (true)
+        {
+            const char* first{ data() + m_begin };
+            const std::size_t available{ m_end - m_begin };
+
+            if (const void* newline{ available ? std::memchr(first, '\n', available) : nullptr })
+            {
+                const std::size_t length{ static_cast<std::size_t>(static_cast<const char*>(newline) - first) };
+
+                line = without_carriage_return(first, length);
+                m_begin += length + 1;
+                ++m_line_number;
+
+                return true;
+            }
+
+            if (refill())
+                continue;
+
+            /// no more input, the last line may not end with a newline
+            if (m_begin == m_end)
+                return false;
+
+            /// refill() may have moved the unread bytes to the front of the buffer
+            line = without_carriage_return(data() + m_begin, m_end - m_begin);
+            m_begin = m_end;
+            ++m_line_number;
+
+            return true;
+        }
+    }
+};
+
+#endif /* LineReader_h */
@@ -63,12 +63,27 @@
  Explicitly opening the files using open() - it works like the file stream constructors, it takes a file
  name and an optional file mode
  
+ -----------------------------------------------------------------------------------------------------------
+ Reading large files line by line:
+ 
+ while (input_file) { std::getline(...); } - copies every line into a std::string, and prints one extra
+ empty line at the end: after the last line is read the stream is still OK, so the loop runs once more,
+ getline fails and input_string stays empty
+ 
+ while (std::getline(input_file, input_string)) - fixes the extra line, the loop stops as soon as getline
+ fails
+ 
+ LineReader - memory maps the file (or reads it in large blocks if it is a pipe), returns every line as a
+ std::string_view pointing into that memory, so nothing is copied, "\r\n" line endings are handled too
+ 
  -----------------------------------------------------------------------------------------------------------
  */
 
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <string_view>
+#include "LineReader.h"
 
 int main()
 {
@@ -116,6 +131,13 @@ int main()
     
     out_to_file.close();
     
+    /// no copies and no extra empty line at the end
+    LineReader reader{ "output_file.txt" };
+    std::string_view line{};
+    
+    while (reader.next(line))
+        std::cout << reader.line_number() << ": " << line << '\n';
+    
     /// writing to the existing file in append mode
     out_to_file.open("output_file.txt", std::ios::app);
     out_to_file << "hello there again\n";
@@ -0,0 +1,232 @@
+//
+//  FileTransform.h
+//  28.7_random.file.IO
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef FileTransform_h
+#define FileTransform_h
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// Changes the bytes of a file in place, a large block at a time instead of one character at a time
+/// The get()/seekg()/<</seekg() loop in main() does three stream operations for every byte it changes,
+/// here a whole block is read, changed in memory, and written back only if something in it changed
+/// POSIX only (macOS, Linux)
+namespace FileTransform
+{
+    /// a replacement byte for every possible byte, the identity mapping to start with
+    class ByteMap
+    {
+    private:
+        std::array<unsigned char, 256> m_table{};
+
+    public:
+        ByteMap()
+        {
+            for (std::size_t ch{ 0 }; ch < m_table.size(); ++ch)
+                m_table[ch] = static_cast<unsigned char>(ch);
+        }
+
+        /// every character in from becomes to
+        ByteMap& replace(std::string_view from, char to)
+        {
+            for (char ch : from)
+                m_table[static_cast<unsigned char>(ch)] = static_cast<unsigned char>(to);
+
+            return *this;
+        }
+
+        /// maps the bytes in place and returns how many of them changed
+        /// bytes that stay the same are not written, so untouched memory pages stay clean
+        std::size_t operator()(char* data, std::size_t length, std::uint64_t /*offset*/) const
+        {
+            std::size_t changed{ 0 };
+
+            for (std::size_t i{ 0 }; i < length; ++i)
+            {
+                const unsigned char before{ static_cast<unsigned char>(data[i]) };
+                const unsigned char after{ m_table[before] };
+
+                if (after != before)
+                {
+                    data[i] = static_cast<char>(after);
+                    ++changed;
+                }
+            }
+
+            return changed;
+        }
+    };
+
+    enum class Mode
+    {
+        blocks,     /// read a block, change it, write it back with pread()/pwrite()
+        mapping,    /// map the file with a shared writable mapping and change it directly in memory
+    };
+
+    struct Options
+    {
+        Mode mode{ Mode::blocks };
+        std::size_t block_size{ 1024 * 1024 };
+        unsigned int threads{ 1 };          /// each thread gets its own part of the file, 0 - use every hardware thread
+    };
+
+    struct Result
+    {
+        bool ok{ false };
+        std::uint64_t bytes_processed{};
+        std::uint64_t bytes_changed{};
+    };
+
+    namespace detail
+    {
+        /// splits [0, size) into count parts, part index gets [first, last)
+        inline void split(std::uint64_t size, unsigned int count, unsigned int index, std::uint64_t& first, std::uint64_t& last)
+        {
+            first = size * index / count;
+            last = size * (index + 1) / count;
+        }
+
+        template <class F>
+        bool process_blocks(int descriptor, std::uint64_t first, std::uint64_t last, std::size_t block_size,
+                            const F& function, std::uint64_t& changed)
+        {
+            std::unique_ptr<char[]> block{ std::make_unique<char[]>(block_size) };
+
+            for (std::uint64_t offset{ first }; offset < last; )
+            {
+                const std::size_t wanted{ static_cast<std::size_t>(std::min<std::uint64_t>(block_size, last - offset)) };
+                const ssize_t count{ ::pread(descriptor, block.get(), wanted, static_cast<off_t>(offset)) };
+
+                if (count <= 0)
+                    return false;
+
+                const std::size_t length{ static_cast<std::size_t>(count) };
+                const std::size_t block_changed{ function(block.get(), length, offset) };
+
+                /// unchanged blocks are never written back
+                if (block_changed > 0)
+                {
+                    if (::pwrite(descriptor, block.get(), length, static_cast<off_t>(offset)) != count)
+                        return false;
+
+                    changed += block_changed;
+                }
+
+                offset += length;
+            }
+
+            return true;
+        }
+    }
+
+    /// calls function(data, length, file offset) on consecutive pieces of the file, function changes
+    /// the bytes in place and returns how many it changed, a piece where it returns 0 isn't written
+    /// with more than one thread, function is called from several threads at once on different parts
+    /// of the file
+    template <class F>
+    Result transform(const char* path, const F& function, const Options& options = {})
+    {
+        Result result{};
+
+        const int descriptor{ ::open(path, O_RDWR) };
+        if (descriptor < 0)
+            return result;
+
+        struct stat info{};
+        if (::fstat(descriptor, &info) != 0)
+        {
+            ::close(descriptor);
+            return result;
+        }
+
+        const std::uint64_t size{ static_cast<std::uint64_t>(info.st_size) };
+        const std::size_t block_size{ std::max<std::size_t>(options.block_size, 4096) };
+
+        unsigned int threads{ options.threads ? options.threads : std::thread::hardware_concurrency() };
+        threads = std::max(1u, std::min<unsigned int>(threads, static_cast<unsigned int>(size / block_size + 1)));
+
+        char* mapping{};
+        if (options.mode == Mode::mapping && size > 0)
+        {
+            void* address{ ::mmap(nullptr, static_cast<std::size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0) };
+            if (address == MAP_FAILED)
+            {
+                ::close(descriptor);
+                return result;
+            }
+
+            mapping = static_cast<char*>(address);
+        }
+
+        std::atomic<std::uint64_t> changed{ 0 };
+        std::atomic<bool> ok{ true };
+
+        auto run = [&](unsigned int index) {
+            std::uint64_t first{};
+            std::uint64_t last{};
+            detail::split(size, threads, index, first, last);
+
+            std::uint64_t part_changed{ 0 };
+
+            if (mapping)
+            {
+                /// the OS writes back only the pages we actually modified
+                for (std::uint64_t offset{ first }; offset < last; offset += block_size)
+                {
+                    const std::size_t length{ static_cast<std::size_t>(std::min<std::uint64_t>(block_size, last - offset)) };
+                    part_changed += function(mapping + offset, length, offset);
+                }
+            }
+            else if (!detail::process_blocks(descriptor, first, last, block_size, function, part_changed))
+                ok = false;
+
+            changed += part_changed;
+        };
+
+        if (threads == 1)
+            run(0);
+        else
+        {
+            std::vector<std::thread> workers{};
+            for (unsigned int index{ 0 }; index < threads; ++index)
+                workers.emplace_back(run, index);
+
+            for (std::thread& worker : workers)
+                worker.join();
+        }
+
+        if (mapping)
+        {
+            if (::msync(mapping, static_cast<std::size_t>(size), MS_SYNC) != 0)
+                ok = false;
+
+            ::munmap(mapping, static_cast<std::size_t>(size));
+        }
+
+        ::close(descriptor);
+
+        result.ok = ok;
+        result.bytes_processed = size;
+        result.bytes_changed = changed;
+
+        return result;
+    }
+}
+
+#endif /* FileTransform_h */
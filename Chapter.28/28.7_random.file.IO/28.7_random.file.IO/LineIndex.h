@@ -0,0 +1,555 @@
+//
+//  LineIndex.h
+//  28.7_random.file.IO
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef LineIndex_h
+#define LineIndex_h
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// Index of where every line of a file starts, so line n can be read with a single seek
+/// instead of calling getline() n times from the beginning of the file
+///
+/// - the index is saved next to the file, in <file>.idx, and loaded instead of rebuilt next time
+/// - building it scans the file with several threads, each one handling its own part of the file
+/// - only every 64th line start is stored in full (a sample), the starts in between are stored as
+///   line lengths in a variable number of bytes (1 byte for lines shorter than 128 characters),
+///   so the index is about 1 byte per line instead of 8
+/// - the file is assumed to only ever grow at the end, update() indexes just the new part
+/// - the index remembers the file's modification time and a hash of the last bytes it indexed, a file
+///   that was rewritten instead of appended to is indexed again from scratch
+/// - a line doesn't include its "\n" or "\r\n", a final '\n' doesn't start another line
+/// POSIX only (macOS, Linux)
+class LineIndex
+{
+public:
+    static constexpr std::uint32_t s_sample_interval{ 64 };
+
+private:
+    static constexpr std::uint32_t s_magic{ 0x5844494C };     /// "LIDX"
+    static constexpr std::uint32_t s_version{ 2 };
+
+    /// how many of the last indexed bytes are hashed to recognize the same file
+    static constexpr std::uint64_t s_tail_bytes{ 4096 };
+
+    std::string m_path{};
+    int m_descriptor{ -1 };
+
+    std::uint64_t m_indexed_size{ 0 };
+    std::int64_t m_indexed_mtime{ 0 };     /// nanoseconds
+    std::uint64_t m_tail_hash{ 0 };
+    std::uint64_t m_line_count{ 0 };
+
+    /// line (g * s_sample_interval) starts at m_samples[g], the lengths of the lines after it are
+    /// in m_deltas starting at m_group_positions[g]
+    std::vector<std::uint64_t> m_samples{};
+    std::vector<std::uint64_t> m_group_positions{};
+    std::vector<std::uint8_t> m_deltas{};
+
+    /// start of the line last added, the next delta is measured from here
+    std::uint64_t m_last_start{ 0 };
+
+    /// LEB128: 7 bits per byte, the top bit says another byte follows
+    static void put_varint(std::vector<std::uint8_t>& out, std::uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    static std::uint64_t get_varint(const std::uint8_t*& in)
+    {
+        std::uint64_t value{ 0 };
+        int shift{ 0 };
+
+        while (*in & 0x80)
+        {
+            value |= static_cast<std::uint64_t>(*in++ & 0x7F) << shift;
+            shift += 7;
+        }
+
+        return value | (static_cast<std::uint64_t>(*in++) << shift);
+    }
+
+    /// one more line starting at offset, lines must be added in order
+    void add_start(std::uint64_t offset)
+    {
+        if (m_line_count % s_sample_interval == 0)
+        {
+            m_samples.push_back(offset);
+            m_group_positions.push_back(m_deltas.size());
+        }
+        else
+            put_varint(m_deltas, offset - m_last_start);
+
+        m_last_start = offset;
+        ++m_line_count;
+    }
+
+    /// the index of one part of the file, built by one thread
+    struct Part
+    {
+        std::uint64_t first_line{};
+        std::vector<std::uint64_t> samples{};
+        std::vector<std::uint64_t> group_positions{};
+        std::vector<std::uint8_t> deltas{};
+    };
+
+    /// number of line starts in [first, last), a line starts at 0 and after every '\n' that isn't the last byte
+    static std::uint64_t count_starts(const char* data, std::uint64_t size, std::uint64_t first, std::uint64_t last)
+    {
+        std::uint64_t count{ first == 0 && size > 0 ? 1u : 0u };
+
+        /// a start at s means a '\n' at s - 1
+        const char* scan{ data + (first == 0 ? 0 : first - 1) };
+        const char* end{ data + std::min(last, size) - 1 };
+
+        while (scan < end)
+        {
+            const void* newline{ std::memchr(scan, '\n', static_cast<std::size_t>(end - scan)) };
+            if (!newline)
+                break;
+
+            ++count;
+            scan = static_cast<const char*>(newline) + 1;
+        }
+
+        return count;
+    }
+
+    /// first line start at or after offset, size if there is none
+    static std::uint64_t next_start(const char* data, std::uint64_t size, std::uint64_t offset)
+    {
+        if (offset == 0)
+            return 0;
+
+        const void* newline{ std::memchr(data + offset - 1, '\n', static_cast<std::size_t>(size - offset)) };
+        return newline ? static_cast<std::uint64_t>(static_cast<const char*>(newline) - data) + 1 : size;
+    }
+
+    /// encodes the groups whose first line starts in [first, last), the last group may run past last
+    static void build_part(const char* data, std::uint64_t size, std::uint64_t first, std::uint64_t last, Part& part)
+    {
+        std::uint64_t line{ part.first_line };
+        std::uint64_t start{ next_start(data, size, first) };
+
+        /// skip to the first line that begins a group
+        while (start < last && line % s_sample_interval != 0)
+        {
+            start = next_start(data, size, start + 1);
+            ++line;
+        }
+
+        while (start < last)
+        {
+            part.samples.push_back(start);
+            part.group_positions.push_back(part.deltas.size());
+
+            std::uint64_t previous{ start };
+            start = next_start(data, size, start + 1);
+            ++line;
+
+            for (; line % s_sample_interval != 0 && start < size; ++line)
+            {
+                put_varint(part.deltas, start - previous);
+                previous = start;
+                start = next_start(data, size, start + 1);
+            }
+        }
+    }
+
+    void clear()
+    {
+        m_indexed_size = 0;
+        m_indexed_mtime = 0;
+        m_tail_hash = 0;
+        m_line_count = 0;
+        m_last_start = 0;
+        m_samples.clear();
+        m_group_positions.clear();
+        m_deltas.clear();
+    }
+
+    std::uint64_t file_size() const
+    {
+        struct stat info{};
+        return ::fstat(m_descriptor, &info) == 0 ? static_cast<std::uint64_t>(info.st_size) : 0;
+    }
+
+    /// last modification time in nanoseconds
+    std::int64_t file_mtime() const
+    {
+        struct stat info{};
+        if (::fstat(m_descriptor, &info) != 0)
+            return 0;
+
+#if defined(__APPLE__)
+        const struct timespec& time{ info.st_mtimespec };
+#else
+        const struct timespec& time{ info.st_mtim };
+#endif
+        return static_cast<std::int64_t>(time.tv_sec) * 1'000'000'000 + static_cast<std::int64_t>(time.tv_nsec);
+    }
+
+    /// FNV-1a hash of the s_tail_bytes bytes before end
+    std::uint64_t tail_hash(std::uint64_t end) const
+    {
+        const std::uint64_t first{ end - std::min(end, s_tail_bytes) };
+        std::string tail(static_cast<std::size_t>(end - first), '\0');
+
+        if (::pread(m_descriptor, tail.data(), tail.size(), static_cast<off_t>(first)) != static_cast<ssize_t>(tail.size()))
+            return 0;
+
+        std::uint64_t hash{ 14695981039346656037u };
+        for (char c : tail)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211u;
+        }
+
+        return hash;
+    }
+
+    /// true if the file still starts with what was indexed: the last indexed bytes hash the same,
+    /// and a file of the same size wasn't modified since (appending always makes it larger)
+    bool matches_file() const
+    {
+        const std::uint64_t size{ file_size() };
+
+        if (size < m_indexed_size || tail_hash(m_indexed_size) != m_tail_hash)
+            return false;
+
+        return size > m_indexed_size || file_mtime() == m_indexed_mtime;
+    }
+
+    /// calls function(data, size) with the whole file mapped into memory
+    template <class F>
+    bool with_mapping(std::uint64_t size, F&& function) const
+    {
+        if (size == 0)
+        {
+            function(nullptr, 0);
+            return true;
+        }
+
+        void* address{ ::mmap(nullptr, static_cast<std::size_t>(size), PROT_READ, MAP_PRIVATE, m_descriptor, 0) };
+        if (address == MAP_FAILED)
+            return false;
+
+        function(static_cast<const char*>(address), size);
+        ::munmap(address, static_cast<std::size_t>(size));
+
+        return true;
+    }
+
+    /// start of line n and the end of its text (before "\n" or "\r\n" is handled by the reader)
+    void line_bounds(std::uint64_t n, std::uint64_t& first, std::uint64_t& last) const
+    {
+        first = line_offset(n);
+        last = (n + 1 < m_line_count) ? line_offset(n + 1) : m_indexed_size;
+    }
+
+    static void trim_line_ending(std::string& line)
+    {
+        if (!line.empty() && line.back() == '\n')
+            line.pop_back();
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+    }
+
+public:
+    /// opens the file, loads <path>.idx if it is up to date, otherwise builds the index and saves it
+    explicit LineIndex(std::string path, unsigned int threads = 0)
+        : m_path{ std::move(path) }, m_descriptor{ ::open(m_path.c_str(), O_RDONLY) }
+    {
+        if (m_descriptor < 0)
+            return;
+
+        if (load())
+            update();
+        else if (build(threads))
+            save();
+    }
+
+    LineIndex(const LineIndex&) = delete;
+    LineIndex& operator=(const LineIndex&) = delete;
+
+    ~LineIndex()
+    {
+        if (m_descriptor >= 0)
+            ::close(m_descriptor);
+    }
+
+    bool is_open() const { return m_descriptor >= 0; }
+    std::uint64_t line_count() const { return m_line_count; }
+    std::string index_path() const { return m_path + ".idx"; }
+
+    /// size of the index in memory, in bytes
+    std::size_t index_bytes() const
+    {
+        return m_samples.size() * sizeof(std::uint64_t) + m_group_positions.size() * sizeof(std::uint64_t) + m_deltas.size();
+    }
+
+    /// indexes the whole file from scratch
+    bool build(unsigned int threads = 0)
+    {
+        clear();
+
+        /// taken before reading, so a change made while indexing shows up as a different time
+        const std::int64_t mtime{ file_mtime() };
+        const std::uint64_t size{ file_size() };
+
+        return with_mapping(size, [&](const char* data, std::uint64_t) {
+            m_indexed_mtime = mtime;
+            if (size == 0)
+                return;
+
+            threads = threads ? threads : std::thread::hardware_concurrency();
+            threads = std::max(1u, std::min<unsigned int>(threads, static_cast<unsigned int>(size / (1024 * 1024) + 1)));
+
+            std::vector<std::uint64_t> bounds(threads + 1);
+            for (unsigned int index{ 0 }; index <= threads; ++index)
+                bounds[index] = size * index / threads;
+
+            std::vector<Part> parts(threads);
+            std::vector<std::uint64_t> counts(threads);
+            std::vector<std::thread> workers{};
+
+            /// pass 1: count the lines in each part, so every part knows its first line number
+            for (unsigned int index{ 0 }; index < threads; ++index)
+                workers.emplace_back([&, index] { counts[index] = count_starts(data, size, bounds[index], bounds[index + 1]); });
+
+            for (std::thread& worker : workers)
+                worker.join();
+            workers.clear();
+
+            for (unsigned int index{ 1 }; index < threads; ++index)
+                parts[index].first_line = parts[index - 1].first_line + counts[index - 1];
+
+            /// pass 2: each part encodes the groups that begin inside it
+            for (unsigned int index{ 0 }; index < threads; ++index)
+                workers.emplace_back([&, index] { build_part(data, size, bounds[index], bounds[index + 1], parts[index]); });
+
+            for (std::thread& worker : workers)
+                worker.join();
+
+            for (const Part& part : parts)
+            {
+                for (std::uint64_t position : part.group_positions)
+                    m_group_positions.push_back(m_deltas.size() + position);
+
+                m_samples.insert(m_samples.end(), part.samples.begin(), part.samples.end());
+                m_deltas.insert(m_deltas.end(), part.deltas.begin(), part.deltas.end());
+            }
+
+            m_line_count = parts.back().first_line + counts.back();
+            m_last_start = m_line_count ? line_offset(m_line_count - 1) : 0;
+            m_indexed_size = size;
+            m_tail_hash = tail_hash(size);
+        });
+    }
+
+    /// indexes whatever was appended to the file since the index was built
+    /// returns false if the file was rewritten (shorter, or the indexed part changed), then the
+    /// index is rebuilt
+    bool update()
+    {
+        if (!matches_file())
+        {
+            build();
+            save();
+            return false;
+        }
+
+        const std::int64_t mtime{ file_mtime() };
+        const std::uint64_t size{ file_size() };
+
+        if (size == m_indexed_size)
+            return true;
+
+        const bool mapped{ with_mapping(size, [&](const char* data, std::uint64_t) {
+            /// the first new line may start right after the last old byte
+            std::uint64_t start{ next_start(data, size, m_indexed_size == 0 ? 0 : m_indexed_size) };
+
+            while (start < size)
+            {
+                add_start(start);
+                start = next_start(data, size, start + 1);
+            }
+
+            m_indexed_size = size;
+            m_indexed_mtime = mtime;
+            m_tail_hash = tail_hash(size);
+        }) };
+
+        return mapped && save();
+    }
+
+    /// byte offset where line n (counting from 0) starts
+    std::uint64_t line_offset(std::uint64_t n) const
+    {
+        const std::uint64_t group{ n / s_sample_interval };
+        std::uint64_t offset{ m_samples[group] };
+
+        const std::uint8_t* in{ m_deltas.data() + m_group_positions[group] };
+        for (std::uint64_t step{ 0 }; step < n % s_sample_interval; ++step)
+            offset += get_varint(in);
+
+        return offset;
+    }
+
+    /// reads line n with one pread(), returns false if there is no such line
+    bool read_line(std::uint64_t n, std::string& line) const
+    {
+        if (n >= m_line_count)
+            return false;
+
+        std::uint64_t first{};
+        std::uint64_t last{};
+        line_bounds(n, first, last);
+
+        line.resize(static_cast<std::size_t>(last - first));
+        if (::pread(m_descriptor, line.data(), line.size(), static_cast<off_t>(first)) != static_cast<ssize_t>(line.size()))
+            return false;
+
+        trim_line_ending(line);
+        return true;
+    }
+
+    /// reads lines [first_line, last_line) with a single pread() of the whole range
+    std::vector<std::string> read_lines(std::uint64_t first_line, std::uint64_t last_line) const
+    {
+        std::vector<std::string> lines{};
+        last_line = std::min(last_line, m_line_count);
+
+        if (first_line >= last_line)
+            return lines;
+
+        const std::uint64_t first{ line_offset(first_line) };
+        const std::uint64_t last{ last_line < m_line_count ? line_offset(last_line) : m_indexed_size };
+
+        std::string block(static_cast<std::size_t>(last - first), '\0');
+        if (::pread(m_descriptor, block.data(), block.size(), static_cast<off_t>(first)) != static_cast<ssize_t>(block.size()))
+            return lines;
+
+        lines.reserve(static_cast<std::size_t>(last_line - first_line));
+
+        std::string_view rest{ block };
+        while (!rest.empty())
+        {
+            const std::size_t end{ rest.find('\n') };
+            std::string line{ rest.substr(0, end) };
+            trim_line_ending(line);
+            lines.push_back(std::move(line));
+
+            rest = (end == std::string_view::npos) ? std::string_view{} : rest.substr(end + 1);
+        }
+
+        return lines;
+    }
+
+    /// writes the index to <path>.idx
+    bool save() const
+    {
+        std::ofstream out{ index_path(), std::ios::binary | std::ios::trunc };
+        if (!out)
+            return false;
+
+        auto write = [&](const auto& value) { out.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+
+        write(s_magic);
+        write(s_version);
+        write(s_sample_interval);
+        write(m_indexed_size);
+        write(m_indexed_mtime);
+        write(m_tail_hash);
+        write(m_line_count);
+        write(m_last_start);
+
+        const std::uint64_t groups{ m_samples.size() };
+        const std::uint64_t delta_bytes{ m_deltas.size() };
+        write(groups);
+        write(delta_bytes);
+
+        out.write(reinterpret_cast<const char*>(m_samples.data()), static_cast<std::streamsize>(groups * sizeof(std::uint64_t)));
+        out.write(reinterpret_cast<const char*>(m_group_positions.data()), static_cast<std::streamsize>(groups * sizeof(std::uint64_t)));
+        out.write(reinterpret_cast<const char*>(m_deltas.data()), static_cast<std::streamsize>(delta_bytes));
+
+        return static_cast<bool>(out);
+    }
+
+    /// reads <path>.idx, returns false if it is missing, damaged, or was made for a file that has
+    /// been rewritten since
+    bool load()
+    {
+        std::ifstream in{ index_path(), std::ios::binary };
+        if (!in)
+            return false;
+
+        auto read = [&](auto& value) { in.read(reinterpret_cast<char*>(&value), sizeof(value)); };
+
+        std::uint32_t magic{};
+        std::uint32_t version{};
+        std::uint32_t interval{};
+        read(magic);
+        read(version);
+        read(interval);
+
+        if (!in || magic != s_magic || version != s_version || interval != s_sample_interval)
+            return false;
+
+        std::uint64_t groups{};
+        std::uint64_t delta_bytes{};
+        read(m_indexed_size);
+        read(m_indexed_mtime);
+        read(m_tail_hash);
+        read(m_line_count);
+        read(m_last_start);
+        read(groups);
+        read(delta_bytes);
+
+        if (!in || !matches_file() || groups != (m_line_count + s_sample_interval - 1) / s_sample_interval)
+        {
+            clear();
+            return false;
+        }
+
+        m_samples.resize(static_cast<std::size_t>(groups));
+        m_group_positions.resize(static_cast<std::size_t>(groups));
+        m_deltas.resize(static_cast<std::size_t>(delta_bytes));
+
+        in.read(reinterpret_cast<char*>(m_samples.data()), static_cast<std::streamsize>(groups * sizeof(std::uint64_t)));
+        in.read(reinterpret_cast<char*>(m_group_positions.data()), static_cast<std::streamsize>(groups * sizeof(std::uint64_t)));
+        in.read(reinterpret_cast<char*>(m_deltas.data()), static_cast<std::streamsize>(delta_bytes));
+
+        if (!in)
+        {
+            clear();
+            return false;
+        }
+
+        return true;
+    }
+};
+
+#endif /* LineIndex_h */
@@ -63,12 +63,37 @@
  Do not write memory addresses to file, the variables that were originally at those addresses may be at
  different addresses when you read their values back in from disk and the addresses will be invalid
  
+ -----------------------------------------------------------------------------------------------------------
+ Changing a large file in place:
+ 
+ the vowel loop below does get(), seekg() and << for every vowel, on a big file the time goes into moving the
+ file pointer back and forth, not into reading or writing
+ 
+ FileTransform::transform() - reads the file a large block at a time, changes the block in memory, writes it
+ back only if something in it changed, or maps the file into memory and changes it there directly, the file
+ can also be split into parts that are changed by several threads at once
+ 
+ FileTransform::ByteMap - says which byte each byte is replaced with, any function with the same signature
+ can be passed instead
+ 
+ -----------------------------------------------------------------------------------------------------------
+ Jumping to a line:
+ 
+ seekg() needs a byte offset, to find where line n starts we have to read all the lines before it, like
+ the getline() and tellg() calls below do
+ 
+ LineIndex - reads the file once and remembers where every line starts, it is saved next to the file as
+ <file>.idx so the next run doesn't have to scan again, read_line(n) and read_lines(first, last) then go
+ straight to the right byte, when more lines are appended to the file only the new part is scanned
+ 
  -----------------------------------------------------------------------------------------------------------
  */
 
 #include <iostream>
 #include <fstream>
 #include <string>
+#include "FileTransform.h"
+#include "LineIndex.h"
 
 int main()
 {
@@ -112,6 +137,16 @@ int main()
     std::getline(input_file, str_data);
     std::cout << input_file.tellg() << '\n';    /// total size of the file is 60 bytes
     
+    /// line offsets found once, then any line is one seek away, lines are counted from 0
+    LineIndex index{ "output_file.txt" };
+    std::cout << "Lines: " << index.line_count() << '\n';
+    
+    if (index.read_line(2, str_data))
+        std::cout << str_data << '\n';
+    
+    for (const std::string& line : index.read_lines(1, 3))
+        std::cout << line << '\n';
+    
     /// in case of fstream , we need to specify both in and out file modes
     std::fstream iofile{ "output_file.txt", std::ios::in | std::ios::out };
     
@@ -154,6 +189,35 @@ int main()
         }
     }
     
+    iofile.close();
+    
+    /// same vowel masking, done a block at a time
+    std::ofstream block_file{ "block_file.txt" };
+    block_file << "This is line 1\nThis is line 2\nThis is line 3\nThis is line 4\n";
+    block_file.close();
+    
+    FileTransform::ByteMap mask_vowels{};
+    mask_vowels.replace("aeiouAEIOU", '*');
+    
+    FileTransform::Result result{ FileTransform::transform("block_file.txt", mask_vowels) };
+    std::cout << result.bytes_changed << " of " << result.bytes_processed << " bytes changed\n";
+    
+    /// through a shared memory mapping; up to two threads, but a thread only gets a block of its
+    /// own, so this small file is still changed by one thread
+    FileTransform::Options options{};
+    options.mode = FileTransform::Mode::mapping;
+    options.threads = 2;
+    
+    FileTransform::ByteMap mask_digits{};
+    mask_digits.replace("0123456789", '#');
+    
+    result = FileTransform::transform("block_file.txt", mask_digits, options);
+    std::cout << result.bytes_changed << " of " << result.bytes_processed << " bytes changed\n";
+    
+    std::ifstream check_file{ "block_file.txt" };
+    while (std::getline(check_file, str_data))
+        std::cout << str_data << '\n';
+    
     /// delete the specified file
     /*std::remove("output_file.txt");*/
     
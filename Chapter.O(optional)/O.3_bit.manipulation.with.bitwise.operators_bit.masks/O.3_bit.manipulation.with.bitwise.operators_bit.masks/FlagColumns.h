@@ -0,0 +1,243 @@
+//
+//  FlagColumns.h
+//  O.3_bit.manipulation.with.bitwise.operators_bit.masks
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef FlagColumns_h
+#define FlagColumns_h
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+#include <vector>
+
+/// A set of bit flags named by an enum, instead of loose constexpr masks like is_sad and is_crying
+/// the enum lists the flags as 0, 1, 2, ... and ends with max_flags, like the enums in the lessons end
+/// with max_suits or max_directions:
+///
+///     enum Feeling { hungry, sad, mad, ..., crying, max_flags };
+///     Flags<Feeling> me{ sad, crying };
+///
+/// the flags are stored in the smallest unsigned integer with enough bits
+template <typename Enum>
+class Flags
+{
+public:
+    static constexpr std::size_t s_count{ static_cast<std::size_t>(Enum::max_flags) };
+
+    static_assert(std::is_enum_v<Enum>, "Flags needs an enum");
+    static_assert(s_count > 0 && s_count <= 64, "Flags holds between 1 and 64 flags");
+
+    using Bits = std::conditional_t<(s_count <= 8), std::uint8_t,
+                 std::conditional_t<(s_count <= 16), std::uint16_t,
+                 std::conditional_t<(s_count <= 32), std::uint32_t, std::uint64_t>>>;
+
+private:
+    Bits m_bits{ 0 };
+
+    static constexpr Bits mask(Enum flag) { return static_cast<Bits>(Bits{ 1 } << static_cast<std::size_t>(flag)); }
+
+    static constexpr Bits all_bits() { return static_cast<Bits>(s_count == 64 ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << s_count) - 1); }
+
+public:
+    constexpr Flags() = default;
+
+    constexpr Flags(std::initializer_list<Enum> flags)
+    {
+        for (Enum flag : flags)
+            m_bits |= mask(flag);
+    }
+
+    static constexpr Flags from_bits(Bits bits)
+    {
+        Flags flags{};
+        flags.m_bits = static_cast<Bits>(bits & all_bits());
+        return flags;
+    }
+
+    constexpr Bits bits() const { return m_bits; }
+
+    constexpr bool test(Enum flag) const { return (m_bits & mask(flag)) != 0; }
+    constexpr Flags& set(Enum flag) { m_bits |= mask(flag); return *this; }
+    constexpr Flags& reset(Enum flag) { m_bits &= static_cast<Bits>(~mask(flag)); return *this; }
+    constexpr Flags& flip(Enum flag) { m_bits ^= mask(flag); return *this; }
+    constexpr Flags& set(Enum flag, bool on) { return on ? set(flag) : reset(flag); }
+
+    constexpr bool any() const { return m_bits != 0; }
+    constexpr bool none() const { return m_bits == 0; }
+
+    /// true if every flag in flags is on
+    constexpr bool all_of(Flags flags) const { return (m_bits & flags.m_bits) == flags.m_bits; }
+
+    constexpr Flags& operator|=(Flags other) { m_bits |= other.m_bits; return *this; }
+    constexpr Flags& operator&=(Flags other) { m_bits &= other.m_bits; return *this; }
+    constexpr Flags& operator^=(Flags other) { m_bits ^= other.m_bits; return *this; }
+
+    friend constexpr Flags operator|(Flags a, Flags b) { return a |= b; }
+    friend constexpr Flags operator&(Flags a, Flags b) { return a &= b; }
+    friend constexpr Flags operator^(Flags a, Flags b) { return a ^= b; }
+
+    /// only the flags the enum defines are turned on
+    friend constexpr Flags operator~(Flags a) { return from_bits(static_cast<Bits>(~a.m_bits)); }
+
+    friend constexpr bool operator==(Flags a, Flags b) { return a.m_bits == b.m_bits; }
+    friend constexpr bool operator!=(Flags a, Flags b) { return a.m_bits != b.m_bits; }
+};
+
+/// The flags of many entities, stored as one bitmap per flag instead of one Flags per entity
+/// bit i of the bitmap for sad is entity i's sad flag, so a question like "sad AND crying AND NOT
+/// asleep" only reads the three bitmaps involved, 64 entities per word, and counting the answers is
+/// one popcount per word
+template <typename Enum>
+class FlagColumns
+{
+public:
+    using FlagSet = Flags<Enum>;
+    static constexpr std::size_t s_count{ FlagSet::s_count };
+
+private:
+    /// a query works on this many words of every bitmap at a time, small enough to stay in the cache
+    static constexpr std::size_t s_block_words{ 256 };
+
+    std::array<std::vector<std::uint64_t>, s_count> m_columns{};
+    std::size_t m_size{ 0 };
+
+    static constexpr std::size_t word_of(std::size_t index) { return index / 64; }
+    static constexpr std::uint64_t bit_of(std::size_t index) { return std::uint64_t{ 1 } << (index % 64); }
+
+    static int popcount(std::uint64_t word) { return __builtin_popcountll(word); }
+    static int lowest_bit(std::uint64_t word) { return __builtin_ctzll(word); }
+
+    /// calls visit(first_word, words, block) for consecutive blocks of words, where block holds the
+    /// AND of the required bitmaps and the complements of the excluded ones
+    template <class Visit>
+    void match_blocks(FlagSet required, FlagSet excluded, Visit visit) const
+    {
+        const std::size_t words{ (m_size + 63) / 64 };
+        std::uint64_t block[s_block_words];
+
+        for (std::size_t first{ 0 }; first < words; first += s_block_words)
+        {
+            const std::size_t count{ std::min(s_block_words, words - first) };
+            std::fill_n(block, count, ~std::uint64_t{ 0 });
+
+            /// one bitmap at a time over the whole block, each pass is a simple loop the compiler vectorizes
+            for (std::size_t flag{ 0 }; flag < s_count; ++flag)
+            {
+                const Enum e{ static_cast<Enum>(flag) };
+                const std::uint64_t* column{ m_columns[flag].data() + first };
+
+                if (required.test(e))
+                    for (std::size_t i{ 0 }; i < count; ++i)
+                        block[i] &= column[i];
+                else if (excluded.test(e))
+                    for (std::size_t i{ 0 }; i < count; ++i)
+                        block[i] &= ~column[i];
+            }
+
+            /// bits past the last entity are never matches
+            if (first + count == words && m_size % 64 != 0)
+                block[count - 1] &= bit_of(m_size) - 1;
+
+            visit(first, count, block);
+        }
+    }
+
+public:
+    std::size_t size() const { return m_size; }
+
+    void reserve(std::size_t entities)
+    {
+        for (std::vector<std::uint64_t>& column : m_columns)
+            column.reserve(word_of(entities + 63));
+    }
+
+    /// adds an entity, returns its index
+    std::size_t push_back(FlagSet flags)
+    {
+        const std::size_t index{ m_size++ };
+
+        if (word_of(index) == m_columns[0].size())
+            for (std::vector<std::uint64_t>& column : m_columns)
+                column.push_back(0);
+
+        for (std::size_t flag{ 0 }; flag < s_count; ++flag)
+            if (flags.test(static_cast<Enum>(flag)))
+                m_columns[flag][word_of(index)] |= bit_of(index);
+
+        return index;
+    }
+
+    FlagSet get(std::size_t index) const
+    {
+        assert(index < m_size && "entity index out of range");
+
+        FlagSet flags{};
+        for (std::size_t flag{ 0 }; flag < s_count; ++flag)
+            flags.set(static_cast<Enum>(flag), (m_columns[flag][word_of(index)] & bit_of(index)) != 0);
+
+        return flags;
+    }
+
+    bool test(std::size_t index, Enum flag) const
+    {
+        assert(index < m_size && "entity index out of range");
+        return (m_columns[static_cast<std::size_t>(flag)][word_of(index)] & bit_of(index)) != 0;
+    }
+
+    void set(std::size_t index, Enum flag, bool on = true)
+    {
+        assert(index < m_size && "entity index out of range");
+
+        std::uint64_t& word{ m_columns[static_cast<std::size_t>(flag)][word_of(index)] };
+        word = on ? (word | bit_of(index)) : (word & ~bit_of(index));
+    }
+
+    void set(std::size_t index, FlagSet flags)
+    {
+        for (std::size_t flag{ 0 }; flag < s_count; ++flag)
+            set(index, static_cast<Enum>(flag), flags.test(static_cast<Enum>(flag)));
+    }
+
+    /// number of entities that have every flag in required and none in excluded
+    std::size_t count(FlagSet required, FlagSet excluded = {}) const
+    {
+        std::size_t total{ 0 };
+
+        match_blocks(required, excluded, [&total](std::size_t, std::size_t words, const std::uint64_t* block) {
+            for (std::size_t i{ 0 }; i < words; ++i)
+                total += static_cast<std::size_t>(popcount(block[i]));
+        });
+
+        return total;
+    }
+
+    /// calls function(index) for every entity that matches, in index order
+    template <class Function>
+    void for_each(FlagSet required, FlagSet excluded, Function function) const
+    {
+        match_blocks(required, excluded, [&function](std::size_t first, std::size_t words, const std::uint64_t* block) {
+            for (std::size_t i{ 0 }; i < words; ++i)
+            {
+                for (std::uint64_t word{ block[i] }; word != 0; word &= word - 1)
+                    function((first + i) * 64 + static_cast<std::size_t>(lowest_bit(word)));
+            }
+        });
+    }
+
+    std::vector<std::size_t> list(FlagSet required, FlagSet excluded = {}) const
+    {
+        std::vector<std::size_t> indexes{};
+        for_each(required, excluded, [&indexes](std::size_t index) { indexes.push_back(index); });
+
+        return indexes;
+    }
+};
+
+#endif /* FlagColumns_h */
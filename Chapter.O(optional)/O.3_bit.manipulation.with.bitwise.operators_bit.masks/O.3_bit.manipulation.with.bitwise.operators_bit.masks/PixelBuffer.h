@@ -0,0 +1,371 @@
+//
+//  PixelBuffer.h
+//  O.3_bit.manipulation.with.bitwise.operators_bit.masks
+//
+//  Created by Εκλεκτός εν Χριστώ on 10/19/26.
+//
+
+#ifndef PixelBuffer_h
+#define PixelBuffer_h
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+/// Whole arrays of RGBA pixels at once, instead of one pixel at a time with masks and shifts
+/// a pixel is the same std::uint32_t as in main.cpp: red in bits 24-31, green 16-23, blue 8-15, alpha 0-7
+/// - split() and pack() convert between packed pixels and one array per channel (planar), with
+///   byte shuffles that handle 16 (SSSE3) or 32 (AVX2) pixels per step
+/// - grayscale(), premultiply() and threshold() are plain loops over whole arrays, simple enough for
+///   the compiler to vectorize them
+/// - parse_hex() and append_hex() read and write hex pixel dumps with lookup tables instead of streams
+/// without SSSE3/AVX2 the same work is done a pixel at a time
+namespace Pixels
+{
+    constexpr std::uint32_t red_bits{ 0xFF000000 };
+    constexpr std::uint32_t green_bits{ 0x00FF0000 };
+    constexpr std::uint32_t blue_bits{ 0x0000FF00 };
+    constexpr std::uint32_t alpha_bits{ 0x000000FF };
+
+    /// one array per channel, channel[i] belongs to pixel i
+    struct PlanarImage
+    {
+        std::vector<std::uint8_t> red{};
+        std::vector<std::uint8_t> green{};
+        std::vector<std::uint8_t> blue{};
+        std::vector<std::uint8_t> alpha{};
+
+        void resize(std::size_t count)
+        {
+            red.resize(count);
+            green.resize(count);
+            blue.resize(count);
+            alpha.resize(count);
+        }
+
+        std::size_t size() const { return red.size(); }
+    };
+
+    namespace detail
+    {
+        inline void split_scalar(const std::uint32_t* pixels, std::size_t count,
+                                 std::uint8_t* red, std::uint8_t* green, std::uint8_t* blue, std::uint8_t* alpha)
+        {
+            for (std::size_t i{ 0 }; i < count; ++i)
+            {
+                const std::uint32_t pixel{ pixels[i] };
+                red[i] = static_cast<std::uint8_t>((pixel & red_bits) >> 24);
+                green[i] = static_cast<std::uint8_t>((pixel & green_bits) >> 16);
+                blue[i] = static_cast<std::uint8_t>((pixel & blue_bits) >> 8);
+                alpha[i] = static_cast<std::uint8_t>(pixel & alpha_bits);
+            }
+        }
+
+        inline void pack_scalar(const std::uint8_t* red, const std::uint8_t* green, const std::uint8_t* blue,
+                                const std::uint8_t* alpha, std::size_t count, std::uint32_t* pixels)
+        {
+            for (std::size_t i{ 0 }; i < count; ++i)
+                pixels[i] = (static_cast<std::uint32_t>(red[i]) << 24) | (static_cast<std::uint32_t>(green[i]) << 16)
+                          | (static_cast<std::uint32_t>(blue[i]) << 8) | alpha[i];
+        }
+
+        /// x / 255 rounded to nearest, for x up to 255 * 255, without a division
+        inline std::uint32_t divide_by_255(std::uint32_t x)
+        {
+            x += 128;
+            return (x + (x >> 8)) >> 8;
+        }
+
+        /// hex digit value for every byte, 0xFF for bytes that aren't hex digits
+        constexpr std::array<std::uint8_t, 256> make_hex_values()
+        {
+            std::array<std::uint8_t, 256> values{};
+            for (std::size_t ch{ 0 }; ch < values.size(); ++ch)
+                values[ch] = 0xFF;
+
+            for (std::uint8_t digit{ 0 }; digit < 10; ++digit)
+                values['0' + digit] = digit;
+
+            for (std::uint8_t digit{ 0 }; digit < 6; ++digit)
+            {
+                values['a' + digit] = static_cast<std::uint8_t>(10 + digit);
+                values['A' + digit] = static_cast<std::uint8_t>(10 + digit);
+            }
+
+            return values;
+        }
+
+        inline constexpr std::array<std::uint8_t, 256> s_hex_values{ make_hex_values() };
+        inline constexpr char s_hex_digits[]{ "0123456789abcdef" };
+
+        inline bool is_space(char ch) { return ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r' || ch == ','; }
+    }
+
+    /// packed pixels to one array per channel, each output array must have room for count bytes
+    inline void split(const std::uint32_t* pixels, std::size_t count,
+                      std::uint8_t* red, std::uint8_t* green, std::uint8_t* blue, std::uint8_t* alpha)
+    {
+        std::size_t i{ 0 };
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+        /// in memory a pixel is the bytes alpha, blue, green, red (little endian)
+        /// the shuffle gathers each channel of 4 pixels into one 32-bit lane, then a 4x4 transpose of
+        /// the lanes puts the same channel of 16 pixels next to each other
+#if defined(__AVX2__)
+        const __m256i gather{ _mm256_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+                                               0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15) };
+        /// the transpose works within 128-bit halves, this puts the 32-bit groups back in pixel order
+        const __m256i order{ _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7) };
+
+        for (; i + 32 <= count; i += 32)
+        {
+            const __m256i* source{ reinterpret_cast<const __m256i*>(pixels + i) };
+            const __m256i v0{ _mm256_shuffle_epi8(_mm256_loadu_si256(source + 0), gather) };
+            const __m256i v1{ _mm256_shuffle_epi8(_mm256_loadu_si256(source + 1), gather) };
+            const __m256i v2{ _mm256_shuffle_epi8(_mm256_loadu_si256(source + 2), gather) };
+            const __m256i v3{ _mm256_shuffle_epi8(_mm256_loadu_si256(source + 3), gather) };
+
+            const __m256i t0{ _mm256_unpacklo_epi32(v0, v1) };
+            const __m256i t1{ _mm256_unpacklo_epi32(v2, v3) };
+            const __m256i t2{ _mm256_unpackhi_epi32(v0, v1) };
+            const __m256i t3{ _mm256_unpackhi_epi32(v2, v3) };
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(alpha + i), _mm256_permutevar8x32_epi32(_mm256_unpacklo_epi64(t0, t1), order));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(blue + i), _mm256_permutevar8x32_epi32(_mm256_unpackhi_epi64(t0, t1), order));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(green + i), _mm256_permutevar8x32_epi32(_mm256_unpacklo_epi64(t2, t3), order));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(red + i), _mm256_permutevar8x32_epi32(_mm256_unpackhi_epi64(t2, t3), order));
+        }
+#else
+        const __m128i gather{ _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15) };
+
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m128i* source{ reinterpret_cast<const __m128i*>(pixels + i) };
+            const __m128i v0{ _mm_shuffle_epi8(_mm_loadu_si128(source + 0), gather) };
+            const __m128i v1{ _mm_shuffle_epi8(_mm_loadu_si128(source + 1), gather) };
+            const __m128i v2{ _mm_shuffle_epi8(_mm_loadu_si128(source + 2), gather) };
+            const __m128i v3{ _mm_shuffle_epi8(_mm_loadu_si128(source + 3), gather) };
+
+            const __m128i t0{ _mm_unpacklo_epi32(v0, v1) };
+            const __m128i t1{ _mm_unpacklo_epi32(v2, v3) };
+            const __m128i t2{ _mm_unpackhi_epi32(v0, v1) };
+            const __m128i t3{ _mm_unpackhi_epi32(v2, v3) };
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(alpha + i), _mm_unpacklo_epi64(t0, t1));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(blue + i), _mm_unpackhi_epi64(t0, t1));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(green + i), _mm_unpacklo_epi64(t2, t3));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(red + i), _mm_unpackhi_epi64(t2, t3));
+        }
+#endif
+#endif
+
+        detail::split_scalar(pixels + i, count - i, red + i, green + i, blue + i, alpha + i);
+    }
+
+    /// one array per channel back to packed pixels
+    inline void pack(const std::uint8_t* red, const std::uint8_t* green, const std::uint8_t* blue,
+                     const std::uint8_t* alpha, std::size_t count, std::uint32_t* pixels)
+    {
+        std::size_t i{ 0 };
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+        /// interleaving alpha with blue and green with red, then the two pairs, gives the pixel bytes
+        /// in memory order
+#if defined(__AVX2__)
+        /// the interleaving works within 128-bit halves, this first spreads the pixels over the halves
+        const __m256i order{ _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7) };
+
+        for (; i + 32 <= count; i += 32)
+        {
+            const __m256i a{ _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(alpha + i)), order) };
+            const __m256i b{ _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(blue + i)), order) };
+            const __m256i g{ _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(green + i)), order) };
+            const __m256i r{ _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(red + i)), order) };
+
+            const __m256i ab_low{ _mm256_unpacklo_epi8(a, b) };
+            const __m256i ab_high{ _mm256_unpackhi_epi8(a, b) };
+            const __m256i gr_low{ _mm256_unpacklo_epi8(g, r) };
+            const __m256i gr_high{ _mm256_unpackhi_epi8(g, r) };
+
+            __m256i* target{ reinterpret_cast<__m256i*>(pixels + i) };
+            _mm256_storeu_si256(target + 0, _mm256_unpacklo_epi16(ab_low, gr_low));
+            _mm256_storeu_si256(target + 1, _mm256_unpackhi_epi16(ab_low, gr_low));
+            _mm256_storeu_si256(target + 2, _mm256_unpacklo_epi16(ab_high, gr_high));
+            _mm256_storeu_si256(target + 3, _mm256_unpackhi_epi16(ab_high, gr_high));
+        }
+#else
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m128i a{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(alpha + i)) };
+            const __m128i b{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(blue + i)) };
+            const __m128i g{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(green + i)) };
+            const __m128i r{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(red + i)) };
+
+            const __m128i ab_low{ _mm_unpacklo_epi8(a, b) };
+            const __m128i ab_high{ _mm_unpackhi_epi8(a, b) };
+            const __m128i gr_low{ _mm_unpacklo_epi8(g, r) };
+            const __m128i gr_high{ _mm_unpackhi_epi8(g, r) };
+
+            __m128i* target{ reinterpret_cast<__m128i*>(pixels + i) };
+            _mm_storeu_si128(target + 0, _mm_unpacklo_epi16(ab_low, gr_low));
+            _mm_storeu_si128(target + 1, _mm_unpackhi_epi16(ab_low, gr_low));
+            _mm_storeu_si128(target + 2, _mm_unpacklo_epi16(ab_high, gr_high));
+            _mm_storeu_si128(target + 3, _mm_unpackhi_epi16(ab_high, gr_high));
+        }
+#endif
+#endif
+
+        detail::pack_scalar(red + i, green + i, blue + i, alpha + i, count - i, pixels + i);
+    }
+
+    inline void split(const std::vector<std::uint32_t>& pixels, PlanarImage& image)
+    {
+        image.resize(pixels.size());
+        split(pixels.data(), pixels.size(), image.red.data(), image.green.data(), image.blue.data(), image.alpha.data());
+    }
+
+    inline void pack(const PlanarImage& image, std::vector<std::uint32_t>& pixels)
+    {
+        pixels.resize(image.size());
+        pack(image.red.data(), image.green.data(), image.blue.data(), image.alpha.data(), image.size(), pixels.data());
+    }
+
+    /// brightness of every pixel, 0.299 red + 0.587 green + 0.114 blue in 8-bit fixed point
+    inline void grayscale(const std::uint32_t* pixels, std::size_t count, std::uint8_t* gray)
+    {
+        for (std::size_t i{ 0 }; i < count; ++i)
+        {
+            const std::uint32_t pixel{ pixels[i] };
+            const std::uint32_t sum{ 77 * (pixel >> 24) + 150 * ((pixel >> 16) & 0xFF) + 29 * ((pixel >> 8) & 0xFF) };
+            gray[i] = static_cast<std::uint8_t>((sum + 128) >> 8);
+        }
+    }
+
+    /// the same for planar channels
+    inline void grayscale(const PlanarImage& image, std::uint8_t* gray)
+    {
+        const std::uint8_t* red{ image.red.data() };
+        const std::uint8_t* green{ image.green.data() };
+        const std::uint8_t* blue{ image.blue.data() };
+
+        for (std::size_t i{ 0 }; i < image.size(); ++i)
+        {
+            const std::uint32_t sum{ 77u * red[i] + 150u * green[i] + 29u * blue[i] };
+            gray[i] = static_cast<std::uint8_t>((sum + 128) >> 8);
+        }
+    }
+
+    /// multiplies red, green and blue by alpha / 255, in place
+    inline void premultiply(std::uint32_t* pixels, std::size_t count)
+    {
+        for (std::size_t i{ 0 }; i < count; ++i)
+        {
+            const std::uint32_t pixel{ pixels[i] };
+            const std::uint32_t alpha{ pixel & alpha_bits };
+
+            const std::uint32_t red{ detail::divide_by_255((pixel >> 24) * alpha) };
+            const std::uint32_t green{ detail::divide_by_255(((pixel >> 16) & 0xFF) * alpha) };
+            const std::uint32_t blue{ detail::divide_by_255(((pixel >> 8) & 0xFF) * alpha) };
+
+            pixels[i] = (red << 24) | (green << 16) | (blue << 8) | alpha;
+        }
+    }
+
+    /// 255 where the channel value is at least level, 0 elsewhere, output may be the same array as channel
+    inline void threshold(const std::uint8_t* channel, std::size_t count, std::uint8_t level, std::uint8_t* output)
+    {
+        for (std::size_t i{ 0 }; i < count; ++i)
+            output[i] = channel[i] >= level ? 0xFF : 0x00;
+    }
+
+    /// reads hex pixels like "ff8000ff 00ff00ff", separated by spaces, commas or new lines, with or
+    /// without "0x", up to 8 digits each, and appends them to pixels
+    /// returns false at the first thing that isn't a hex pixel, the pixels before it are kept
+    inline bool parse_hex(std::string_view text, std::vector<std::uint32_t>& pixels)
+    {
+        const char* position{ text.data() };
+        const char* const end{ text.data() + text.size() };
+
+        while (true)
+        {
+            while (position != end && detail::is_space(*position))
+                ++position;
+
+            if (position == end)
+                return true;
+
+            if (end - position >= 2 && position[0] == '0' && (position[1] == 'x' || position[1] == 'X'))
+                position += 2;
+
+            std::uint32_t pixel{ 0 };
+            int digits{ 0 };
+
+            /// the common case, exactly 8 digits, without a check for the end of the number in between
+            if (end - position >= 8)
+            {
+                std::uint32_t invalid{ 0 };
+                for (int digit{ 0 }; digit < 8; ++digit)
+                {
+                    const std::uint8_t value{ detail::s_hex_values[static_cast<unsigned char>(position[digit])] };
+                    invalid |= value & 0xF0;
+                    pixel = (pixel << 4) | (value & 0x0F);
+                }
+
+                if (invalid == 0)
+                {
+                    position += 8;
+                    digits = 8;
+                }
+                else
+                    pixel = 0;
+            }
+
+            for (; digits < 8 && position != end; ++digits, ++position)
+            {
+                const std::uint8_t value{ detail::s_hex_values[static_cast<unsigned char>(*position)] };
+                if (value == 0xFF)
+                    break;
+
+                pixel = (pixel << 4) | value;
+            }
+
+            if (digits == 0 || (position != end && !detail::is_space(*position)))
+                return false;
+
+            pixels.push_back(pixel);
+        }
+    }
+
+    /// appends the pixels as 8 lowercase hex digits each, per_line pixels per line separated by spaces
+    inline void append_hex(const std::uint32_t* pixels, std::size_t count, std::string& text, std::size_t per_line = 8)
+    {
+        if (count == 0)
+            return;
+
+        per_line = per_line ? per_line : 1;
+
+        const std::size_t start{ text.size() };
+        text.resize(start + count * 9);
+        char* out{ text.data() + start };
+
+        for (std::size_t i{ 0 }; i < count; ++i)
+        {
+            const std::uint32_t pixel{ pixels[i] };
+            for (int digit{ 7 }; digit >= 0; --digit)
+                *out++ = detail::s_hex_digits[(pixel >> (digit * 4)) & 0xF];
+
+            *out++ = ((i + 1) % per_line == 0 || i + 1 == count) ? '\n' : ' ';
+        }
+    }
+}
+
+#endif /* PixelBuffer_h */
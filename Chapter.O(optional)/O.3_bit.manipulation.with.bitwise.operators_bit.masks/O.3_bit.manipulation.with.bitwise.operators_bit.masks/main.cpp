@@ -57,6 +57,25 @@
  */
 
 #include <iostream>
+#include <string>
+#include <vector>
+#include "PixelBuffer.h"
+#include "FlagColumns.h"
+
+/// the same meanings as the is_hungry ... is_crying masks in main(), as flag numbers
+enum Feeling
+{
+    hungry,
+    sad,
+    mad,
+    happy,
+    laughing,
+    asleep,
+    dead,
+    crying,
+    
+    max_flags
+};
 
 int main()
 {
@@ -175,6 +194,23 @@ int main()
     std::cout << "I'm sad: " << static_cast<bool>(me & is_sad) << '\n';
     std::cout << "I'm crying: " << static_cast<bool>(me & is_crying) << '\n';
     
+    /// the same with named flags, and for many people at once: one bitmap per flag, so
+    /// "sad AND crying AND NOT asleep" is answered 64 people at a time
+    Flags<Feeling> also_me{ sad, crying };
+    std::cout << "Also sad: " << also_me.test(sad) << ", also crying: " << also_me.test(crying) << '\n';
+    
+    FlagColumns<Feeling> people{};
+    for (int person{ 0 }; person < 1000; ++person)
+    {
+        Flags<Feeling> feelings{};
+        feelings.set(sad, person % 2 == 0);
+        feelings.set(crying, person % 3 == 0);
+        feelings.set(asleep, person % 5 == 0);
+        people.push_back(feelings);
+    }
+    
+    std::cout << "sad and crying but awake: " << people.count({ sad, crying }, { asleep }) << '\n';
+    
     constexpr std::uint32_t red_bits{0xFF000000};
     constexpr std::uint32_t green_bits{0x00FF0000};
     constexpr std::uint32_t blue_bits{0x0000FF00};
@@ -196,6 +232,30 @@ int main()
     std::cout << "green: " << static_cast<int>(green) << '\n';
     std::cout << "blue: " << static_cast<int>(blue) << '\n';
     std::cout << "alpha: " << static_cast<int>(alpha) << '\n';
+    std::cout << std::dec;
+    
+    /// the same for a whole array of pixels at once, read from and written back to a hex dump
+    std::vector<std::uint32_t> pixels{};
+    Pixels::parse_hex("ff0000ff 00ff0080 0000ff40 ffffff00 808080ff", pixels);
+    pixels.push_back(pixel);
+    
+    Pixels::PlanarImage image{};
+    Pixels::split(pixels, image);
+    
+    std::vector<std::uint8_t> gray(pixels.size());
+    Pixels::grayscale(image, gray.data());
+    Pixels::threshold(gray.data(), gray.size(), 128, gray.data());
+    
+    Pixels::premultiply(pixels.data(), pixels.size());
+    
+    std::string dump{};
+    Pixels::append_hex(pixels.data(), pixels.size(), dump);
+    std::cout << "premultiplied: " << dump;
+    
+    std::cout << "bright: ";
+    for (std::uint8_t value : gray)
+        std::cout << (value ? '#' : '.');
+    std::cout << '\n';
     
     return 0;
 }
@@ -139,6 +139,8 @@
  */
 
 #include <iostream>
+#include <string_view>
+#include "IntegerText.h"
 
 int printAndDecrementOne(int x, int pow)
 {
@@ -164,6 +166,7 @@ int main()
     std::cout << "Enter an integer between 0 and 255: ";
     int x{};
     std::cin >> x;
+    const int entered{ x };
 
     x = printAndDecrementBit(x, 128);
     x = printAndDecrementBit(x, 64);
@@ -179,5 +182,10 @@ int main()
 
     std::cout << '\n';
 
+    /// the same 8 bits from a lookup table, one byte at a time instead of one bit at a time
+    char bits[IntegerText::max_binary_digits<int>]{};
+    IntegerText::to_binary(bits, entered, 8);
+    std::cout << std::string_view{ bits, 4 } << ' ' << std::string_view{ bits + 4, 4 } << '\n';
+
     return 0;
 }